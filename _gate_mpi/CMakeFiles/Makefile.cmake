@@ -0,0 +1,124 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/XSDKDefaults.cmake"
+  "/root/repo/cmake/bob.cmake"
+  "/root/repo/cmake/detect_trilinos_opts.cmake"
+  "/root/repo/cmake/osh_use_dolfin.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "Omega_hConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/CMakeFiles/omega_h.dir/DependInfo.cmake"
+  "src/CMakeFiles/msh2osh.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh2vtk.dir/DependInfo.cmake"
+  "src/CMakeFiles/oshdiff.dir/DependInfo.cmake"
+  "src/CMakeFiles/vtkdiff.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh_box.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh_part.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh_scale.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh_reorder.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh_fix.dir/DependInfo.cmake"
+  "src/CMakeFiles/osh_eval_implied.dir/DependInfo.cmake"
+  "src/CMakeFiles/mox_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/unit_tests.dir/DependInfo.cmake"
+  "src/CMakeFiles/r3d_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/mpi_tests.dir/DependInfo.cmake"
+  "src/CMakeFiles/1d_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/corner_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/coarsen_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/2d_conserve_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/warp_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/3d_conserve_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/motion_unit_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/perf_tests.dir/DependInfo.cmake"
+  "src/CMakeFiles/ring_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/aniso_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/imr_cases.dir/DependInfo.cmake"
+  "src/CMakeFiles/curvature_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/bend_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/test_degree.dir/DependInfo.cmake"
+  "src/CMakeFiles/test_dihedral.dir/DependInfo.cmake"
+  "src/CMakeFiles/slope_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/advect2d_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/check.dir/DependInfo.cmake"
+  "src/CMakeFiles/cylinder_adapt_test.dir/DependInfo.cmake"
+  "src/CMakeFiles/flood_test.dir/DependInfo.cmake"
+  )
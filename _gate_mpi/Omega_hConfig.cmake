@@ -0,0 +1,63 @@
+set(Omega_h_VERSION 9.6.0)
+#The definition of this macro is really inconvenient prior to CMake
+#commit ab358d6a859d8b7e257ed1e06ca000e097a32ef6
+#we'll just copy the latest code into our Config.cmake file
+macro(latest_find_dependency dep)
+  if (NOT ${dep}_FOUND)
+    set(cmake_fd_quiet_arg)
+    if(${CMAKE_FIND_PACKAGE_NAME}_FIND_QUIETLY)
+      set(cmake_fd_quiet_arg QUIET)
+    endif()
+    set(cmake_fd_required_arg)
+    if(${CMAKE_FIND_PACKAGE_NAME}_FIND_REQUIRED)
+      set(cmake_fd_required_arg REQUIRED)
+    endif()
+
+    get_property(cmake_fd_alreadyTransitive GLOBAL PROPERTY
+      _CMAKE_${dep}_TRANSITIVE_DEPENDENCY
+    )
+
+    find_package(${dep} ${ARGN}
+      ${cmake_fd_quiet_arg}
+      ${cmake_fd_required_arg}
+    )
+
+    if(NOT DEFINED cmake_fd_alreadyTransitive OR cmake_fd_alreadyTransitive)
+      set_property(GLOBAL PROPERTY _CMAKE_${dep}_TRANSITIVE_DEPENDENCY TRUE)
+    endif()
+
+    if (NOT ${dep}_FOUND)
+      set(${CMAKE_FIND_PACKAGE_NAME}_NOT_FOUND_MESSAGE "${CMAKE_FIND_PACKAGE_NAME} could not be found because dependency ${dep} could not be found.")
+      set(${CMAKE_FIND_PACKAGE_NAME}_FOUND False)
+      return()
+    endif()
+    set(cmake_fd_required_arg)
+    set(cmake_fd_quiet_arg)
+    set(cmake_fd_exact_arg)
+  endif()
+endmacro(latest_find_dependency)
+
+latest_find_dependency(ZLIB )
+set(Omega_h_EXPORTED_TARGETS "omega_h;msh2osh;osh2vtk;oshdiff;vtkdiff;osh_box;osh_part;osh_scale;osh_reorder;osh_fix;osh_eval_implied;mox_test")
+foreach(tgt IN LISTS Omega_h_EXPORTED_TARGETS)
+  include(${CMAKE_CURRENT_LIST_DIR}/${tgt}-target.cmake)
+endforeach()
+set(Omega_h_USE_MPI "ON")
+set(Omega_h_USE_KokkosCore "OFF")
+set(Omega_h_USE_OpenMP "OFF")
+set(Omega_h_USE_CUDA "")
+set(Omega_h_USE_ZLIB "ON")
+set(Omega_h_USE_LZ4 "OFF")
+set(Omega_h_USE_ZSTD "OFF")
+set(Omega_h_USE_libMeshb "OFF")
+set(Omega_h_USE_EGADS "OFF")
+set(Omega_h_USE_SEACASExodus "OFF")
+set(Omega_h_USE_Teuchos "OFF")
+set(Omega_h_USE_DOLFIN "OFF")
+set(Omega_h_CHECK_BOUNDS "OFF")
+set(Omega_h_USE_CUDA_AWARE_MPI "OFF")
+set(Omega_h_VERSION_MAJOR "9")
+set(Omega_h_VERSION_MINOR "6")
+set(Omega_h_VERSION_PATCH "0")
+set(Omega_h_SEMVER "9.6.0-sha.8167d5d+10001000000000")
+set(Omega_h_CXX_FLAGS " -O3 -g --std=c++11  -fno-omit-frame-pointer ")
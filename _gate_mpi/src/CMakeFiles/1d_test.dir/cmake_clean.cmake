@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "1d_test"
+  "1d_test.pdb"
+  "CMakeFiles/1d_test.dir/1d_test.cpp.o"
+  "CMakeFiles/1d_test.dir/1d_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/1d_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
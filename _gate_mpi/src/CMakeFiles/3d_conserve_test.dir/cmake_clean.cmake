@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "3d_conserve_test"
+  "3d_conserve_test.pdb"
+  "CMakeFiles/3d_conserve_test.dir/3d_conserve_test.cpp.o"
+  "CMakeFiles/3d_conserve_test.dir/3d_conserve_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/3d_conserve_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "Omega_h::omega_h" for configuration ""
+set_property(TARGET Omega_h::omega_h APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(Omega_h::omega_h PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_NOCONFIG "CXX"
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/lib/libomega_h.a"
+  )
+
+list(APPEND _cmake_import_check_targets Omega_h::omega_h )
+list(APPEND _cmake_import_check_files_for_Omega_h::omega_h "${_IMPORT_PREFIX}/lib/libomega_h.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,18 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "Omega_h::vtkdiff" for configuration ""
+set_property(TARGET Omega_h::vtkdiff APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(Omega_h::vtkdiff PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "${_IMPORT_PREFIX}/bin/vtkdiff"
+  )
+
+list(APPEND _cmake_import_check_targets Omega_h::vtkdiff )
+list(APPEND _cmake_import_check_files_for_Omega_h::vtkdiff "${_IMPORT_PREFIX}/bin/vtkdiff" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/advect2d_test.dir/advect2d_test.cpp.o"
+  "CMakeFiles/advect2d_test.dir/advect2d_test.cpp.o.d"
+  "advect2d_test"
+  "advect2d_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/advect2d_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/aniso_test.dir/aniso_test.cpp.o"
+  "CMakeFiles/aniso_test.dir/aniso_test.cpp.o.d"
+  "aniso_test"
+  "aniso_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aniso_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
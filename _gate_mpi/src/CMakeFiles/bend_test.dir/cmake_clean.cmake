@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bend_test.dir/bend_test.cpp.o"
+  "CMakeFiles/bend_test.dir/bend_test.cpp.o.d"
+  "bend_test"
+  "bend_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bend_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
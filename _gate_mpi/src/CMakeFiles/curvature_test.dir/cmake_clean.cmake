@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/curvature_test.dir/curvature_test.cpp.o"
+  "CMakeFiles/curvature_test.dir/curvature_test.cpp.o.d"
+  "curvature_test"
+  "curvature_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/curvature_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cylinder_adapt_test.dir/cylinder_adapt_test.cpp.o"
+  "CMakeFiles/cylinder_adapt_test.dir/cylinder_adapt_test.cpp.o.d"
+  "cylinder_adapt_test"
+  "cylinder_adapt_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cylinder_adapt_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/imr_cases.dir/imr_cases.cpp.o"
+  "CMakeFiles/imr_cases.dir/imr_cases.cpp.o.d"
+  "imr_cases"
+  "imr_cases.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/imr_cases.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/motion_unit_test.dir/motion_unit_test.cpp.o"
+  "CMakeFiles/motion_unit_test.dir/motion_unit_test.cpp.o.d"
+  "motion_unit_test"
+  "motion_unit_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/motion_unit_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
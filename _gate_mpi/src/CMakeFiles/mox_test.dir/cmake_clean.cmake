@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mox_test.dir/mox_test.cpp.o"
+  "CMakeFiles/mox_test.dir/mox_test.cpp.o.d"
+  "mox_test"
+  "mox_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mox_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
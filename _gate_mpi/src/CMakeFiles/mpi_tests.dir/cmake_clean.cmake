@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mpi_tests.dir/mpi_tests.cpp.o"
+  "CMakeFiles/mpi_tests.dir/mpi_tests.cpp.o.d"
+  "mpi_tests"
+  "mpi_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mpi_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
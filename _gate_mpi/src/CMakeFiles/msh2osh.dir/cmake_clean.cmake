@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/msh2osh.dir/msh2osh.cpp.o"
+  "CMakeFiles/msh2osh.dir/msh2osh.cpp.o.d"
+  "msh2osh"
+  "msh2osh.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/msh2osh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,108 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Omega_h_adapt.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_adapt.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_adapt.cpp.o.d"
+  "/root/repo/src/Omega_h_adj.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_adj.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_adj.cpp.o.d"
+  "/root/repo/src/Omega_h_align.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_align.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_align.cpp.o.d"
+  "/root/repo/src/Omega_h_approach.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_approach.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_approach.cpp.o.d"
+  "/root/repo/src/Omega_h_array.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_array.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_array.cpp.o.d"
+  "/root/repo/src/Omega_h_array_ops.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_array_ops.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_array_ops.cpp.o.d"
+  "/root/repo/src/Omega_h_assoc.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_assoc.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_assoc.cpp.o.d"
+  "/root/repo/src/Omega_h_base64.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_base64.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_base64.cpp.o.d"
+  "/root/repo/src/Omega_h_bbox.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_bbox.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_bbox.cpp.o.d"
+  "/root/repo/src/Omega_h_bcast.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_bcast.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_bcast.cpp.o.d"
+  "/root/repo/src/Omega_h_bipart.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_bipart.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_bipart.cpp.o.d"
+  "/root/repo/src/Omega_h_box.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_box.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_box.cpp.o.d"
+  "/root/repo/src/Omega_h_build.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_build.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_build.cpp.o.d"
+  "/root/repo/src/Omega_h_c.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_c.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_c.cpp.o.d"
+  "/root/repo/src/Omega_h_check_collapse.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_check_collapse.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_check_collapse.cpp.o.d"
+  "/root/repo/src/Omega_h_class.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_class.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_class.cpp.o.d"
+  "/root/repo/src/Omega_h_cmdline.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_cmdline.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_cmdline.cpp.o.d"
+  "/root/repo/src/Omega_h_coarsen.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen.cpp.o.d"
+  "/root/repo/src/Omega_h_coarsen_flip.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_flip.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_flip.cpp.o.d"
+  "/root/repo/src/Omega_h_coarsen_overshoot.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_overshoot.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_overshoot.cpp.o.d"
+  "/root/repo/src/Omega_h_coarsen_qualities.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_qualities.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_qualities.cpp.o.d"
+  "/root/repo/src/Omega_h_coarsen_topology.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_topology.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_coarsen_topology.cpp.o.d"
+  "/root/repo/src/Omega_h_collapse_rail.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_collapse_rail.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_collapse_rail.cpp.o.d"
+  "/root/repo/src/Omega_h_comm.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_comm.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_comm.cpp.o.d"
+  "/root/repo/src/Omega_h_compare.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_compare.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_compare.cpp.o.d"
+  "/root/repo/src/Omega_h_confined.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_confined.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_confined.cpp.o.d"
+  "/root/repo/src/Omega_h_conserve.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_conserve.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_conserve.cpp.o.d"
+  "/root/repo/src/Omega_h_consistent.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_consistent.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_consistent.cpp.o.d"
+  "/root/repo/src/Omega_h_control.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_control.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_control.cpp.o.d"
+  "/root/repo/src/Omega_h_diffuse.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_diffuse.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_diffuse.cpp.o.d"
+  "/root/repo/src/Omega_h_dist.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_dist.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_dist.cpp.o.d"
+  "/root/repo/src/Omega_h_eigen.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_eigen.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_eigen.cpp.o.d"
+  "/root/repo/src/Omega_h_file.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_file.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_file.cpp.o.d"
+  "/root/repo/src/Omega_h_fix.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_fix.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_fix.cpp.o.d"
+  "/root/repo/src/Omega_h_flood.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_flood.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_flood.cpp.o.d"
+  "/root/repo/src/Omega_h_future.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_future.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_future.cpp.o.d"
+  "/root/repo/src/Omega_h_ghost.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_ghost.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_ghost.cpp.o.d"
+  "/root/repo/src/Omega_h_gmsh.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_gmsh.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_gmsh.cpp.o.d"
+  "/root/repo/src/Omega_h_graph.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_graph.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_graph.cpp.o.d"
+  "/root/repo/src/Omega_h_hilbert.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_hilbert.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_hilbert.cpp.o.d"
+  "/root/repo/src/Omega_h_histogram.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_histogram.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_histogram.cpp.o.d"
+  "/root/repo/src/Omega_h_indset.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_indset.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_indset.cpp.o.d"
+  "/root/repo/src/Omega_h_inertia.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_inertia.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_inertia.cpp.o.d"
+  "/root/repo/src/Omega_h_int128.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_int128.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_int128.cpp.o.d"
+  "/root/repo/src/Omega_h_laplace.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_laplace.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_laplace.cpp.o.d"
+  "/root/repo/src/Omega_h_linpart.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_linpart.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_linpart.cpp.o.d"
+  "/root/repo/src/Omega_h_map.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_map.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_map.cpp.o.d"
+  "/root/repo/src/Omega_h_mark.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_mark.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_mark.cpp.o.d"
+  "/root/repo/src/Omega_h_matrix.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_matrix.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_matrix.cpp.o.d"
+  "/root/repo/src/Omega_h_mesh.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_mesh.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_mesh.cpp.o.d"
+  "/root/repo/src/Omega_h_metric.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_metric.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_metric.cpp.o.d"
+  "/root/repo/src/Omega_h_metric_input.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_metric_input.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_metric_input.cpp.o.d"
+  "/root/repo/src/Omega_h_migrate.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_migrate.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_migrate.cpp.o.d"
+  "/root/repo/src/Omega_h_modify.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_modify.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_modify.cpp.o.d"
+  "/root/repo/src/Omega_h_motion.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_motion.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_motion.cpp.o.d"
+  "/root/repo/src/Omega_h_motion_choices.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_motion_choices.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_motion_choices.cpp.o.d"
+  "/root/repo/src/Omega_h_motion_transfer.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_motion_transfer.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_motion_transfer.cpp.o.d"
+  "/root/repo/src/Omega_h_multilevel.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_multilevel.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_multilevel.cpp.o.d"
+  "/root/repo/src/Omega_h_owners.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_owners.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_owners.cpp.o.d"
+  "/root/repo/src/Omega_h_pool.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_pool.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_pool.cpp.o.d"
+  "/root/repo/src/Omega_h_profile.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_profile.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_profile.cpp.o.d"
+  "/root/repo/src/Omega_h_quality.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_quality.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_quality.cpp.o.d"
+  "/root/repo/src/Omega_h_recover.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_recover.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_recover.cpp.o.d"
+  "/root/repo/src/Omega_h_refine.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_refine.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_refine.cpp.o.d"
+  "/root/repo/src/Omega_h_refine_qualities.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_refine_qualities.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_refine_qualities.cpp.o.d"
+  "/root/repo/src/Omega_h_refine_topology.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_refine_topology.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_refine_topology.cpp.o.d"
+  "/root/repo/src/Omega_h_regress.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_regress.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_regress.cpp.o.d"
+  "/root/repo/src/Omega_h_remotes.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_remotes.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_remotes.cpp.o.d"
+  "/root/repo/src/Omega_h_reorder.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_reorder.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_reorder.cpp.o.d"
+  "/root/repo/src/Omega_h_scan.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_scan.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_scan.cpp.o.d"
+  "/root/repo/src/Omega_h_scatterplot.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_scatterplot.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_scatterplot.cpp.o.d"
+  "/root/repo/src/Omega_h_shape.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_shape.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_shape.cpp.o.d"
+  "/root/repo/src/Omega_h_simplex.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_simplex.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_simplex.cpp.o.d"
+  "/root/repo/src/Omega_h_simplify.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_simplify.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_simplify.cpp.o.d"
+  "/root/repo/src/Omega_h_sort.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_sort.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_sort.cpp.o.d"
+  "/root/repo/src/Omega_h_surface.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_surface.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_surface.cpp.o.d"
+  "/root/repo/src/Omega_h_swap.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap.cpp.o.d"
+  "/root/repo/src/Omega_h_swap2d.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap2d.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap2d.cpp.o.d"
+  "/root/repo/src/Omega_h_swap2d_qualities.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap2d_qualities.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap2d_qualities.cpp.o.d"
+  "/root/repo/src/Omega_h_swap2d_topology.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap2d_topology.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap2d_topology.cpp.o.d"
+  "/root/repo/src/Omega_h_swap3d.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap3d.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap3d.cpp.o.d"
+  "/root/repo/src/Omega_h_swap3d_qualities.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap3d_qualities.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap3d_qualities.cpp.o.d"
+  "/root/repo/src/Omega_h_swap3d_topology.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_swap3d_topology.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_swap3d_topology.cpp.o.d"
+  "/root/repo/src/Omega_h_tag.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_tag.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_tag.cpp.o.d"
+  "/root/repo/src/Omega_h_timer.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_timer.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_timer.cpp.o.d"
+  "/root/repo/src/Omega_h_transfer.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_transfer.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_transfer.cpp.o.d"
+  "/root/repo/src/Omega_h_unmap_mesh.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_unmap_mesh.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_unmap_mesh.cpp.o.d"
+  "/root/repo/src/Omega_h_vector.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_vector.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_vector.cpp.o.d"
+  "/root/repo/src/Omega_h_vtk.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_vtk.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_vtk.cpp.o.d"
+  "/root/repo/src/Omega_h_xml.cpp" "src/CMakeFiles/omega_h.dir/Omega_h_xml.cpp.o" "gcc" "src/CMakeFiles/omega_h.dir/Omega_h_xml.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,189 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/omega_h.dir/Omega_h_adapt.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_adapt.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_adj.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_adj.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_align.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_align.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_approach.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_approach.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_array.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_array.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_array_ops.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_array_ops.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_assoc.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_assoc.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_base64.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_base64.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_bbox.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_bbox.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_bcast.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_bcast.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_bipart.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_bipart.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_box.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_box.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_build.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_build.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_c.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_c.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_check_collapse.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_check_collapse.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_class.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_class.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_cmdline.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_cmdline.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_flip.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_flip.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_overshoot.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_overshoot.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_qualities.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_qualities.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_topology.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_coarsen_topology.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_collapse_rail.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_collapse_rail.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_comm.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_comm.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_compare.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_compare.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_confined.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_confined.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_conserve.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_conserve.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_consistent.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_consistent.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_control.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_control.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_diffuse.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_diffuse.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_dist.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_dist.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_eigen.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_eigen.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_file.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_file.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_fix.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_fix.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_flood.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_flood.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_future.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_future.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_ghost.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_ghost.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_gmsh.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_gmsh.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_graph.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_graph.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_hilbert.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_hilbert.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_histogram.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_histogram.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_indset.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_indset.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_inertia.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_inertia.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_int128.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_int128.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_laplace.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_laplace.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_linpart.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_linpart.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_map.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_map.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_mark.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_mark.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_matrix.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_matrix.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_mesh.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_mesh.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_metric.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_metric.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_metric_input.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_metric_input.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_migrate.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_migrate.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_modify.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_modify.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_motion.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_motion.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_motion_choices.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_motion_choices.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_motion_transfer.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_motion_transfer.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_multilevel.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_multilevel.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_owners.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_owners.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_pool.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_pool.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_profile.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_profile.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_quality.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_quality.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_recover.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_recover.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_refine.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_refine.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_refine_qualities.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_refine_qualities.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_refine_topology.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_refine_topology.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_regress.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_regress.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_remotes.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_remotes.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_reorder.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_reorder.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_scan.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_scan.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_scatterplot.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_scatterplot.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_shape.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_shape.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_simplex.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_simplex.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_simplify.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_simplify.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_sort.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_sort.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_surface.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_surface.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap2d.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap2d.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap2d_qualities.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap2d_qualities.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap2d_topology.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap2d_topology.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap3d.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap3d.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap3d_qualities.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap3d_qualities.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_swap3d_topology.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_swap3d_topology.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_tag.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_tag.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_timer.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_timer.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_transfer.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_transfer.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_unmap_mesh.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_unmap_mesh.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_vector.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_vector.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_vtk.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_vtk.cpp.o.d"
+  "CMakeFiles/omega_h.dir/Omega_h_xml.cpp.o"
+  "CMakeFiles/omega_h.dir/Omega_h_xml.cpp.o.d"
+  "libomega_h.a"
+  "libomega_h.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/omega_h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
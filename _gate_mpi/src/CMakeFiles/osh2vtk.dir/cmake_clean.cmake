@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh2vtk.dir/osh2vtk.cpp.o"
+  "CMakeFiles/osh2vtk.dir/osh2vtk.cpp.o.d"
+  "osh2vtk"
+  "osh2vtk.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh2vtk.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
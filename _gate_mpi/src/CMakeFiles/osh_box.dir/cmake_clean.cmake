@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh_box.dir/osh_box.cpp.o"
+  "CMakeFiles/osh_box.dir/osh_box.cpp.o.d"
+  "osh_box"
+  "osh_box.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh_box.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
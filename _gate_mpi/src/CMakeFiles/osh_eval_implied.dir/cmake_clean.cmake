@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh_eval_implied.dir/osh_eval_implied.cpp.o"
+  "CMakeFiles/osh_eval_implied.dir/osh_eval_implied.cpp.o.d"
+  "osh_eval_implied"
+  "osh_eval_implied.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh_eval_implied.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
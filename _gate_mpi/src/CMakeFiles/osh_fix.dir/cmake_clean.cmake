@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh_fix.dir/osh_fix.cpp.o"
+  "CMakeFiles/osh_fix.dir/osh_fix.cpp.o.d"
+  "osh_fix"
+  "osh_fix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh_fix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
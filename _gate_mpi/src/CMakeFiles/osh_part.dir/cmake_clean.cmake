@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh_part.dir/osh_part.cpp.o"
+  "CMakeFiles/osh_part.dir/osh_part.cpp.o.d"
+  "osh_part"
+  "osh_part.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh_part.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
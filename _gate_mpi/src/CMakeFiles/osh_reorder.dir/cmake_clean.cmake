@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh_reorder.dir/osh_reorder.cpp.o"
+  "CMakeFiles/osh_reorder.dir/osh_reorder.cpp.o.d"
+  "osh_reorder"
+  "osh_reorder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh_reorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/osh_scale.dir/osh_scale.cpp.o"
+  "CMakeFiles/osh_scale.dir/osh_scale.cpp.o.d"
+  "osh_scale"
+  "osh_scale.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/osh_scale.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/oshdiff.dir/oshdiff.cpp.o"
+  "CMakeFiles/oshdiff.dir/oshdiff.cpp.o.d"
+  "oshdiff"
+  "oshdiff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/oshdiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/r3d_test.dir/r3d_test.cpp.o"
+  "CMakeFiles/r3d_test.dir/r3d_test.cpp.o.d"
+  "r3d_test"
+  "r3d_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/r3d_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slope_test.dir/slope_test.cpp.o"
+  "CMakeFiles/slope_test.dir/slope_test.cpp.o.d"
+  "slope_test"
+  "slope_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slope_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
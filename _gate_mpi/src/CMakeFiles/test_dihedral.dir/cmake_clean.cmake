@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dihedral.dir/test_dihedral.cpp.o"
+  "CMakeFiles/test_dihedral.dir/test_dihedral.cpp.o.d"
+  "test_dihedral"
+  "test_dihedral.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dihedral.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/vtkdiff.dir/vtkdiff.cpp.o"
+  "CMakeFiles/vtkdiff.dir/vtkdiff.cpp.o.d"
+  "vtkdiff"
+  "vtkdiff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/vtkdiff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
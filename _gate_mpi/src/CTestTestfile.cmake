@@ -0,0 +1,34 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_gate_mpi/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(run_unit_tests "/usr/bin/mpirun" "-np" "1" "./unit_tests")
+set_tests_properties(run_unit_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;326;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_test_r3d "/usr/bin/mpirun" "-np" "1" "./r3d_test")
+set_tests_properties(run_test_r3d PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;328;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_mpi_tests "/usr/bin/mpirun" "-np" "4" "./mpi_tests")
+set_tests_properties(run_mpi_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;332;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_mpi_tests_node "/usr/bin/mpirun" "-np" "4" "./mpi_tests" "--osh-node-exchange" "1048576")
+set_tests_properties(run_mpi_tests_node PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;335;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_mpi_tests_node_overflow "/usr/bin/mpirun" "-np" "4" "./mpi_tests" "--osh-node-exchange" "16")
+set_tests_properties(run_mpi_tests_node_overflow PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;336;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(serial_1d_test "/usr/bin/mpirun" "-np" "1" "./1d_test")
+set_tests_properties(serial_1d_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;342;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(parallel_1d_test "/usr/bin/mpirun" "-np" "2" "./1d_test")
+set_tests_properties(parallel_1d_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;344;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_corner_test "/usr/bin/mpirun" "-np" "1" "./corner_test")
+set_tests_properties(run_corner_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;347;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_coarsen_test "/usr/bin/mpirun" "-np" "1" "./coarsen_test")
+set_tests_properties(run_coarsen_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;349;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(serial_2d_conserve "/usr/bin/mpirun" "-np" "1" "./2d_conserve_test")
+set_tests_properties(serial_2d_conserve PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;351;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(parallel_2d_conserve "/usr/bin/mpirun" "-np" "2" "./2d_conserve_test")
+set_tests_properties(parallel_2d_conserve PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;353;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(warp_test_serial "/usr/bin/mpirun" "-np" "1" "./warp_test")
+set_tests_properties(warp_test_serial PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;357;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(warp_test_parallel "/usr/bin/mpirun" "-np" "2" "./warp_test")
+set_tests_properties(warp_test_parallel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;359;test_func;/root/repo/src/CMakeLists.txt;0;")
+add_test(run_aniso_test "/usr/bin/mpirun" "-np" "1" "./aniso_test")
+set_tests_properties(run_aniso_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/CMakeLists.txt;298;add_test;/root/repo/src/CMakeLists.txt;379;test_func;/root/repo/src/CMakeLists.txt;0;")
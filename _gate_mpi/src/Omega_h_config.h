@@ -0,0 +1,12 @@
+#ifndef OMEGA_H_CONFIG_H
+#define OMEGA_H_CONFIG_H
+
+#define OMEGA_H_USE_MPI
+#define OMEGA_H_USE_ZLIB
+#define OMEGA_H_VERSION_MAJOR 9
+#define OMEGA_H_VERSION_MINOR 6
+#define OMEGA_H_VERSION_PATCH 0
+#define OMEGA_H_SEMVER "9.6.0-sha.8167d5d+10001000000000"
+#define OMEGA_H_CXX_FLAGS " -O3 -g --std=c++11  -fno-omit-frame-pointer "
+
+#endif
@@ -9,6 +9,7 @@
 #include "Omega_h_histogram.hpp"
 #include "Omega_h_laplace.hpp"
 #include "Omega_h_map.hpp"
+#include "Omega_h_mark.hpp"
 #include "Omega_h_motion.hpp"
 #include "Omega_h_quality.hpp"
 #include "Omega_h_refine.hpp"
@@ -85,7 +86,14 @@ AdaptOpts::AdaptOpts(Int dim) {
   should_coarsen = true;
   should_swap = true;
   should_coarsen_slivers = true;
+  should_smooth_slivers = false;
+  max_smooth_rounds = 3;
   should_prevent_coarsen_flip = false;
+  should_skip_clean = false;
+  ndirty_layers = 1;
+  reordering = DONT_REORDER;
+  reorder_every = 0;
+  min_locality = 0.0;
 }
 
 static Reals get_fixable_qualities(Mesh* mesh, AdaptOpts const&) {
@@ -142,6 +150,8 @@ static void validate(Mesh* mesh, AdaptOpts const& opts) {
   OMEGA_H_CHECK(opts.min_quality_desired <= 1.0);
   OMEGA_H_CHECK(opts.nsliver_layers >= 0);
   OMEGA_H_CHECK(opts.nsliver_layers < 100);
+  OMEGA_H_CHECK(opts.ndirty_layers >= 0);
+  OMEGA_H_CHECK(opts.max_smooth_rounds >= 0);
   auto mq = min_fixable_quality(mesh, opts);
   if (mq < opts.min_quality_allowed && !mesh->comm()->rank()) {
     std::cout << "WARNING: worst input element has quality " << mq
@@ -163,52 +173,131 @@ static bool pre_adapt(Mesh* mesh, AdaptOpts const& opts) {
   return true;
 }
 
-static void post_rebuild(Mesh* mesh, AdaptOpts const& opts) {
+/* what one call to adapt() counts while it runs.
+   each rebuild applies one independent set of keys, see find_indset() */
+struct AdaptState {
+  AdaptState()
+      : nrebuilds(0),
+        nrebuilds_since_reorder(0),
+        nsmooth_rounds(0),
+        smoothing_stalled(false),
+        nunmigrated_bytes(0) {}
+  /* full mesh rebuilds, reported at the end */
+  Int nrebuilds;
+  Int nrebuilds_since_reorder;
+  /* smooth_slivers() rounds since the last rebuild, and whether
+     the last one could not move anything */
+  Int nsmooth_rounds;
+  bool smoothing_stalled;
+  /* Mesh::nunmigrated_bytes() when adapt() started */
+  GO nunmigrated_bytes;
+};
+
+static void reorder(Mesh* mesh, AdaptOpts const& opts) {
+  begin_code("reorder");
+  if ((opts.verbosity >= EACH_REBUILD) && can_print(mesh)) {
+    std::cout << "reordering for locality\n";
+  }
+  if (opts.reordering == REORDER_BY_RCM) {
+    reorder_by_rcm(mesh);
+  } else {
+    reorder_by_hilbert(mesh);
+  }
+  end_code();
+}
+
+static void maybe_reorder(
+    Mesh* mesh, AdaptOpts const& opts, AdaptState* state) {
+  if (opts.reordering == DONT_REORDER) return;
+  /* the ghosting that starts the next operation would undo it,
+     see the final reordering in adapt() */
+  if (mesh->comm()->size() > 1) return;
+  ++state->nrebuilds_since_reorder;
+  bool should_reorder = (opts.reorder_every > 0 &&
+                         state->nrebuilds_since_reorder >= opts.reorder_every);
+  if (!should_reorder && opts.min_locality > 0.0) {
+    should_reorder = (measure_locality(mesh) < opts.min_locality);
+  }
+  if (!should_reorder) return;
+  reorder(mesh, opts);
+  state->nrebuilds_since_reorder = 0;
+}
+
+static void post_rebuild(
+    Mesh* mesh, AdaptOpts const& opts, AdaptState* state) {
+  ++state->nrebuilds;
+  state->nsmooth_rounds = 0;
+  state->smoothing_stalled = false;
+  maybe_reorder(mesh, opts, state);
   if (opts.verbosity >= EACH_REBUILD) print_adapt_status(mesh, opts);
 }
 
-static void satisfy_lengths(Mesh* mesh, AdaptOpts const& opts) {
+static void satisfy_lengths(
+    Mesh* mesh, AdaptOpts const& opts, AdaptState* state) {
   begin_code("satisfy_lengths");
   bool did_anything;
   do {
     did_anything = false;
     if (opts.should_refine && refine_by_size(mesh, opts)) {
-      post_rebuild(mesh, opts);
+      post_rebuild(mesh, opts, state);
       did_anything = true;
     }
     if (opts.should_coarsen && coarsen_by_size(mesh, opts)) {
-      post_rebuild(mesh, opts);
+      post_rebuild(mesh, opts, state);
       did_anything = true;
     }
   } while (did_anything);
   end_code();
 }
 
-static bool satisfy_quality(Mesh* mesh, AdaptOpts const& opts) {
+static bool satisfy_quality(
+    Mesh* mesh, AdaptOpts const& opts, AdaptState* state) {
   if (min_fixable_quality(mesh, opts) >= opts.min_quality_desired) return true;
   begin_code("satisfy_quality");
   if ((opts.verbosity >= EACH_REBUILD) && can_print(mesh)) {
     std::cout << "addressing element qualities\n";
   }
   do {
+    /* each round ghosts and unghosts the mesh, so only
+       (max_smooth_rounds) of them come before trying to swap,
+       and none once nothing could move, until a rebuild changes
+       the slivers */
+    auto can_smooth = opts.should_smooth_slivers &&
+                      opts.max_smooth_rounds > 0 && !state->smoothing_stalled;
+    if (can_smooth && state->nsmooth_rounds < opts.max_smooth_rounds) {
+      if (smooth_slivers(mesh, opts)) {
+        ++state->nsmooth_rounds;
+        if (opts.verbosity >= EACH_REBUILD) print_adapt_status(mesh, opts);
+        continue;
+      }
+      state->smoothing_stalled = true;
+      can_smooth = false;
+    }
     if (opts.should_swap && swap_edges(mesh, opts)) {
-      post_rebuild(mesh, opts);
+      post_rebuild(mesh, opts, state);
       continue;
     }
     if (opts.should_coarsen_slivers && coarsen_slivers(mesh, opts)) {
-      post_rebuild(mesh, opts);
+      post_rebuild(mesh, opts, state);
+      continue;
+    }
+    /* with nothing else left, more rounds are worth their cost */
+    if (can_smooth) {
+      state->nsmooth_rounds = 0;
       continue;
     }
     if ((opts.verbosity > SILENT) && can_print(mesh)) {
       std::cout << "could not satisfy quality\n";
     }
+    end_code();
     return false;
   } while (min_fixable_quality(mesh, opts) < opts.min_quality_desired);
   end_code();
   return true;
 }
 
-static void snap_and_satisfy_quality(Mesh* mesh, AdaptOpts const& opts) {
+static void snap_and_satisfy_quality(
+    Mesh* mesh, AdaptOpts const& opts, AdaptState* state) {
 #ifdef OMEGA_H_USE_EGADS
   if (opts.egads_model) {
     begin_code("snap");
@@ -229,7 +318,7 @@ static void snap_and_satisfy_quality(Mesh* mesh, AdaptOpts const& opts) {
     }
     mesh->add_tag(VERT, "warp", mesh->dim(), warp);
     while (warp_to_limit(mesh, opts, opts.allow_snap_failure)) {
-      if (!satisfy_quality(mesh, opts)) {
+      if (!satisfy_quality(mesh, opts, state)) {
         mesh->remove_tag(VERT, "warp");
         break;
       }
@@ -237,11 +326,11 @@ static void snap_and_satisfy_quality(Mesh* mesh, AdaptOpts const& opts) {
     end_code();
   } else
 #endif
-    satisfy_quality(mesh, opts);
+    satisfy_quality(mesh, opts, state);
 }
 
-static void post_adapt(
-    Mesh* mesh, AdaptOpts const& opts, Now t0, Now t1, Now t2, Now t3, Now t4) {
+static void post_adapt(Mesh* mesh, AdaptOpts const& opts,
+    AdaptState const& state, Now t0, Now t1, Now t2, Now t3, Now t4) {
   if (opts.verbosity == EACH_ADAPT) {
     if (!mesh->comm()->rank()) std::cout << "after adapting:\n";
     print_adapt_status(mesh, opts);
@@ -262,20 +351,30 @@ static void post_adapt(
     std::cout << "correcting integral errors took " << (t4 - t3)
               << " seconds\n";
   }
+  if (opts.verbosity > SILENT && mesh->comm()->size() > 1) {
+    auto nbytes = mesh->comm()->allreduce(
+        mesh->nunmigrated_bytes() - state.nunmigrated_bytes, OMEGA_H_SUM);
+    if (!mesh->comm()->rank()) {
+      std::cout << "unghosting in place kept " << nbytes
+                << " bytes of tag data from being migrated\n";
+    }
+  }
   Now t5 = now();
   if (opts.verbosity > SILENT && !mesh->comm()->rank()) {
-    std::cout << "adapting took " << (t5 - t0) << " seconds\n\n";
+    std::cout << "adapting took " << (t5 - t0) << " seconds and "
+              << state.nrebuilds << " rebuilds\n\n";
   }
 }
 
-static void correct_size_errors(Mesh* mesh, AdaptOpts const& opts) {
+static void correct_size_errors(
+    Mesh* mesh, AdaptOpts const& opts, AdaptState* state) {
   if (opts.xfer_opts.should_conserve_size) {
     begin_code("correct_size_errors");
     // vtk::Writer writer("motion", mesh);
     // writer.write();
     while (move_verts_to_conserve_size(mesh, opts)) {
       // writer.write();
-      post_rebuild(mesh, opts);
+      post_rebuild(mesh, opts, state);
     }
     end_code();
   }
@@ -285,17 +384,26 @@ bool adapt(Mesh* mesh, AdaptOpts const& opts) {
   auto t0 = now();
   if (!pre_adapt(mesh, opts)) return false;
   begin_code("adapt");
+  AdaptState state;
+  state.nunmigrated_bytes = mesh->nunmigrated_bytes();
   setup_conservation_tags(mesh, opts);
+  if (opts.should_skip_clean) {
+    mesh->add_tag(VERT, "dirty", 1, Read<I8>(mesh->nverts(), I8(ALL_DIRTY)));
+  }
   auto t1 = now();
-  satisfy_lengths(mesh, opts);
+  satisfy_lengths(mesh, opts, &state);
   auto t2 = now();
-  snap_and_satisfy_quality(mesh, opts);
+  snap_and_satisfy_quality(mesh, opts, &state);
   auto t3 = now();
-  correct_size_errors(mesh, opts);
+  correct_size_errors(mesh, opts, &state);
   correct_integral_errors(mesh, opts);
+  mesh->remove_tag(VERT, "dirty");
   auto t4 = now();
   mesh->set_parting(OMEGA_H_ELEM_BASED);
-  post_adapt(mesh, opts, t0, t1, t2, t3, t4);
+  if (opts.reordering != DONT_REORDER && mesh->comm()->size() > 1) {
+    reorder(mesh, opts);
+  }
+  post_adapt(mesh, opts, state, t0, t1, t2, t3, t4);
   end_code();
   return true;
 }
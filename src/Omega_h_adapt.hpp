@@ -31,6 +31,10 @@ struct TransferOpts {
 
 enum Verbosity { SILENT, EACH_ADAPT, EACH_REBUILD, EXTRA_STATS };
 
+/* how to renumber entities for memory locality during adaptation,
+   see reorder_by_hilbert() and reorder_by_rcm() */
+enum Reordering { DONT_REORDER, REORDER_BY_HILBERT, REORDER_BY_RCM };
+
 #ifdef OMEGA_H_USE_EGADS
 struct Egads;
 #endif
@@ -59,7 +63,31 @@ struct AdaptOpts {
   bool should_coarsen;
   bool should_swap;
   bool should_coarsen_slivers;
+  /* before swapping, move vertices of low quality elements
+     without changing the topology, in up to (max_smooth_rounds)
+     rounds before each attempt to swap */
+  bool should_smooth_slivers;
+  Int max_smooth_rounds;
   bool should_prevent_coarsen_flip;
+  /* operations after the first only look for candidates within
+     (ndirty_layers) element layers of what changed since their last
+     call, since candidates they rejected elsewhere would be
+     rejected again. this is off by default, since that only holds
+     while a rejection depends on nothing beyond those layers */
+  bool should_skip_clean;
+  Int ndirty_layers;
+  /* with a (reordering) other than DONT_REORDER, a serial mesh is
+     renumbered after every (reorder_every) rebuilds (if positive)
+     and whenever measure_locality() drops below (min_locality).
+     new entities are numbered in the local order of the elements
+     around each key, so the results then differ from those of
+     DONT_REORDER and of a parallel run.
+     in parallel, the ghosting of every operation restores global
+     order, so each rank only reorders its local entities once
+     adapt() is done, keeping global numbers and thus the results */
+  Reordering reordering;
+  Int reorder_every;
+  Real min_locality;
   TransferOpts xfer_opts;
 };
 
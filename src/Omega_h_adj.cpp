@@ -1,7 +1,10 @@
 #include "Omega_h_adj.hpp"
 
+#include <cstdint>
+
 #include "Omega_h_align.hpp"
 #include "Omega_h_array_ops.hpp"
+#include "Omega_h_atomics.hpp"
 #include "Omega_h_control.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
@@ -115,9 +118,87 @@ Read<I8> find_canonical_jumps(Int deg, LOs canon, LOs e_sorted2e) {
   return jumps;
 }
 
+/* The hash-based alternative to sorting canonical vertex lists:
+   an open-addressing table with linear probing, where each slot
+   holds the index of an entity (use) whose canonical vertex list
+   claimed that slot, or -1 if the slot is empty.
+   Slots are claimed concurrently by compare-and-swap. */
+
+static LO get_hash_capacity(LO n) {
+  /* keep the load factor at or below one half */
+  LO capacity = 1;
+  while (capacity < 2 * n) capacity *= 2;
+  return capacity;
+}
+
+OMEGA_H_DEVICE static LO hash_canonical(
+    Int deg, LOs const& canon, LO e, LO mask) {
+  std::uint32_t h = 0;
+  for (Int j = 0; j < deg; ++j) {
+    h ^= std::uint32_t(canon[e * deg + j]);
+    h *= 0x9e3779b1u;
+    h ^= h >> 15;
+  }
+  return LO(h & std::uint32_t(mask));
+}
+
+/* inserts all entities and returns the slot of each.
+   equal vertex lists end up in the same slot, which
+   holds whichever of them got there first. */
+static LOs hash_insert(Int deg, LOs canon, Write<LO> slots) {
+  auto ne = divide_no_remainder(canon.size(), deg);
+  auto mask = slots.size() - 1;
+  Write<LO> e2slot(ne);
+  auto f = OMEGA_H_LAMBDA(LO e) {
+    auto slot = hash_canonical(deg, canon, e, mask);
+    while (true) {
+      auto other = slots[slot];
+      if (other == -1) {
+        other = atomic_compare_exchange<LO>(&slots[slot], -1, e);
+        if (other == -1) break;
+      }
+      if (are_equal(deg, canon, e, other)) break;
+      slot = (slot + 1) & mask;
+    }
+    e2slot[e] = slot;
+  };
+  parallel_for(ne, f, "hash_insert");
+  return e2slot;
+}
+
+/* lowers each slot to the smallest entity index that maps to it,
+   so the outcome does not depend on thread scheduling */
+static void hash_take_smallest(LOs e2slot, Write<LO> slots) {
+  auto f = OMEGA_H_LAMBDA(LO e) {
+    auto slot = e2slot[e];
+    auto other = slots[slot];
+    while (e < other) {
+      auto prev = atomic_compare_exchange<LO>(&slots[slot], other, e);
+      if (prev == other) break;
+      other = prev;
+    }
+  };
+  parallel_for(e2slot.size(), f, "hash_take_smallest");
+}
+
+/* the unique entities are numbered by the first use
+   of each, which also determines their orientation */
+static LOs hash_find_unique_deg(Int deg, LOs uv2v, LOs uv2v_canon) {
+  auto nu = divide_no_remainder(uv2v.size(), deg);
+  Write<LO> slots(get_hash_capacity(nu), -1);
+  auto u2slot = hash_insert(deg, uv2v_canon, slots);
+  hash_take_smallest(u2slot, slots);
+  Write<I8> is_first(nu);
+  auto f = OMEGA_H_LAMBDA(LO u) { is_first[u] = (slots[u2slot[u]] == u); };
+  parallel_for(nu, f, "hash_find_unique");
+  auto e2u = collect_marked(Read<I8>(is_first));
+  return unmap<LO>(e2u, uv2v, deg);
+}
+
 static LOs find_unique_deg(Int deg, LOs uv2v) {
   auto codes = get_codes_to_canonical(deg, uv2v);
   auto uv2v_canon = align_ev2v(deg, uv2v, codes);
+  if (should_hash_dedup) return hash_find_unique_deg(deg, uv2v, uv2v_canon);
   auto sorted2u = sort_by_keys(uv2v_canon, deg);
   auto jumps = find_canonical_jumps(deg, uv2v_canon, sorted2u);
   auto e2sorted = collect_marked(jumps);
@@ -289,9 +370,70 @@ void find_matches_ex(Int deg, LOs a2fv, Read<T> av2v, Read<T> bv2v, Adj v2b,
   }
 }
 
+/* looks up each use (a) among the entities (b) in a hash table
+   of the latter, then derives the alignment code by locating
+   the first vertex of the use in the entity */
+template <Int deg>
+static void hash_find_matches_deg(
+    LOs av2v, LOs bv2v, LOs* a2b_out, Read<I8>* codes_out) {
+  auto na = divide_no_remainder(av2v.size(), deg);
+  auto nb = divide_no_remainder(bv2v.size(), deg);
+  auto av2v_canon = align_ev2v(deg, av2v, get_codes_to_canonical(deg, av2v));
+  auto bv2v_canon = align_ev2v(deg, bv2v, get_codes_to_canonical(deg, bv2v));
+  Write<LO> slots(get_hash_capacity(nb), -1);
+  hash_insert(deg, bv2v_canon, slots);
+  auto mask = slots.size() - 1;
+  Write<LO> a2b(na);
+  Write<I8> codes(na);
+  auto f = OMEGA_H_LAMBDA(LO a) {
+    auto slot = hash_canonical(deg, av2v_canon, a, mask);
+    while (true) {
+      auto b = slots[slot];
+      if (b == -1) break;
+      bool same = true;
+      for (Int j = 0; j < deg; ++j) {
+        if (av2v_canon[a * deg + j] != bv2v_canon[b * deg + j]) same = false;
+      }
+      if (same) {
+        auto a_begin = a * deg;
+        auto b_begin = b * deg;
+        for (Int which_down = 0; which_down < deg; ++which_down) {
+          if (bv2v[b_begin + which_down] != av2v[a_begin]) continue;
+          I8 match_code;
+          if (IsMatch<deg>::eval(
+                  av2v, a_begin, bv2v, b_begin, which_down, &match_code)) {
+            a2b[a] = b;
+            codes[a] = match_code;
+            return;
+          }
+        }
+        break;
+      }
+      slot = (slot + 1) & mask;
+    }
+    OMEGA_H_NORETURN();
+  };
+  parallel_for(na, f, "hash_find_matches");
+  *a2b_out = a2b;
+  *codes_out = codes;
+}
+
+static void hash_find_matches(
+    Int deg, LOs av2v, LOs bv2v, LOs* a2b_out, Read<I8>* codes_out) {
+  if (deg == 2) {
+    hash_find_matches_deg<2>(av2v, bv2v, a2b_out, codes_out);
+  } else if (deg == 3) {
+    hash_find_matches_deg<3>(av2v, bv2v, a2b_out, codes_out);
+  }
+}
+
 void find_matches(
     Int dim, LOs av2v, LOs bv2v, Adj v2b, LOs* a2b_out, Read<I8>* codes_out) {
   auto deg = dim + 1;
+  if (should_hash_dedup) {
+    hash_find_matches(deg, av2v, bv2v, a2b_out, codes_out);
+    return;
+  }
   auto a2fv = get_component(av2v, deg, 0);
   find_matches_ex(deg, a2fv, av2v, bv2v, v2b, a2b_out, codes_out);
 }
@@ -307,7 +449,9 @@ Adj reflect_down(LOs hv2v, LOs lv2v, Adj v2l, Int high_dim, Int low_dim) {
 Adj reflect_down(LOs hv2v, LOs lv2v, LO nv, Int high_dim, Int low_dim) {
   Int nverts_per_low = simplex_degrees[low_dim][0];
   auto l2v = Adj(lv2v);
-  Adj v2l = invert_adj(l2v, nverts_per_low, nv);
+  /* the hash table path does not need upward adjacency */
+  Adj v2l;
+  if (!should_hash_dedup) v2l = invert_adj(l2v, nverts_per_low, nv);
   return reflect_down(hv2v, lv2v, v2l, high_dim, low_dim);
 }
 
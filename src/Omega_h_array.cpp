@@ -6,6 +6,7 @@
 #include "Omega_h_control.hpp"
 #include "Omega_h_functors.hpp"
 #include "Omega_h_loop.hpp"
+#include "Omega_h_pool.hpp"
 
 namespace Omega_h {
 
@@ -37,6 +38,7 @@ std::size_t get_max_bytes() { return max_array_bytes; }
 
 template <typename T>
 void Write<T>::log_allocation() const {
+  if (profile::global_singleton_history) profile::simple_add_bytes(bytes());
   if (!should_log_memory) return;
   current_array_bytes += bytes();
   if (current_array_bytes > max_array_bytes) {
@@ -51,6 +53,19 @@ void Write<T>::log_allocation() const {
   }
 }
 
+#ifndef OMEGA_H_USE_KOKKOSCORE
+/* returns a block to the pool it came from.
+   holding a reference to the pool lets arrays
+   outlive the Library that created them. */
+template <typename T>
+struct PoolDeleter {
+  PoolPtr pool_;
+  std::size_t bytes_;
+  PoolDeleter(PoolPtr pool, std::size_t bytes) : pool_(pool), bytes_(bytes) {}
+  void operator()(T* p) const { pool_->deallocate(p, bytes_); }
+};
+#endif
+
 #ifdef OMEGA_H_USE_KOKKOSCORE
 template <typename T>
 Write<T>::Write(Kokkos::View<T*> view_in) : view_(view_in) {
@@ -66,13 +81,28 @@ Write<T>::Write(LO size_in, std::string const& name) {
       static_cast<std::size_t>(size_in));
 #else
   (void)name;
-  ptr_ = decltype(ptr_)(new T[size_in], std::default_delete<T[]>());
+  auto pool = get_array_pool();
+  if (pool) {
+    auto nbytes = static_cast<std::size_t>(size_in) * sizeof(T);
+    ptr_ = decltype(ptr_)(static_cast<T*>(pool->allocate(nbytes)),
+        PoolDeleter<T>(pool, nbytes));
+  } else {
+    ptr_ = decltype(ptr_)(new T[size_in], std::default_delete<T[]>());
+  }
   size_ = size_in;
 #endif
   log_allocation();
   // end_code();
 }
 
+#ifndef OMEGA_H_USE_KOKKOSCORE
+template <typename T>
+Write<T>::Write(LO size_in, std::shared_ptr<T> ptr_in)
+    : ptr_(ptr_in), size_(size_in) {
+  log_allocation();
+}
+#endif
+
 template <typename T>
 void Write<T>::check_release() const {
   if (should_log_memory && use_count() == 1) {
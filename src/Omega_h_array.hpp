@@ -32,6 +32,12 @@ class Write {
   Write(LO size_in, T value, std::string const& name = "");
   Write(LO size_in, T offset, T stride, std::string const& name = "");
   Write(HostWrite<T> host_write);
+#ifndef OMEGA_H_USE_KOKKOSCORE
+  /* adopts storage owned elsewhere (e.g. memory-mapped file pages),
+     (ptr_in) should keep that owner alive through its deleter or
+     through the shared_ptr aliasing constructor */
+  Write(LO size_in, std::shared_ptr<T> ptr_in);
+#endif
   OMEGA_H_INLINE Write(Write<T> const& other)
       :
 #ifdef OMEGA_H_USE_KOKKOSCORE
@@ -1,5 +1,6 @@
 #include "Omega_h_array_ops.hpp"
 
+#include "Omega_h_lazy.hpp"
 #include "Omega_h_loop.hpp"
 
 namespace Omega_h {
@@ -84,7 +85,7 @@ T get_max(CommPtr comm, Read<T> a) {
 
 template <typename T>
 MinMax<T> get_minmax(CommPtr comm, Read<T> a) {
-  return {get_min(comm, a), get_max(comm, a)};
+  return lazy::get_minmax(comm, a);
 }
 
 struct AreClose : public AndFunctor {
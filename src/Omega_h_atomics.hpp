@@ -21,6 +21,41 @@ struct Atomics<true> {
   static OMEGA_H_INLINE T fetch_add(volatile T* const dest, const T val) {
     return Kokkos::atomic_fetch_add(dest, val);
   }
+  template <typename T>
+  static OMEGA_H_INLINE T compare_exchange(
+      volatile T* const dest, const T compare, const T val) {
+    return Kokkos::atomic_compare_exchange(dest, compare, val);
+  }
+};
+#elif defined(OMEGA_H_USE_OPENMP)
+template <>
+struct Atomics<true> {
+  template <typename T>
+  static OMEGA_H_INLINE void increment(volatile T* const dest) {
+#pragma omp atomic update
+    ++(*dest);
+  }
+  template <typename T>
+  static OMEGA_H_INLINE void add(volatile T* const dest, const T val) {
+#pragma omp atomic update
+    *dest += val;
+  }
+  template <typename T>
+  static OMEGA_H_INLINE T fetch_add(volatile T* const dest, const T val) {
+    T tmp;
+#pragma omp atomic capture
+    {
+      tmp = *dest;
+      *dest += val;
+    }
+    return tmp;
+  }
+  /* OpenMP only gained a compare-and-swap construct in 5.1 */
+  template <typename T>
+  static OMEGA_H_INLINE T compare_exchange(
+      volatile T* const dest, const T compare, const T val) {
+    return __sync_val_compare_and_swap(dest, compare, val);
+  }
 };
 #endif
 
@@ -40,11 +75,20 @@ struct Atomics<false> {
     *dest += val;
     return tmp;
   }
+  template <typename T>
+  static OMEGA_H_INLINE T compare_exchange(
+      volatile T* const dest, const T compare, const T val) {
+    T tmp = *dest;
+    if (tmp == compare) *dest = val;
+    return tmp;
+  }
 };
 
 #ifdef OMEGA_H_USE_KOKKOSCORE
 constexpr bool enable_atomics =
     !std::is_same<Kokkos::DefaultExecutionSpace, Kokkos::Serial>::value;
+#elif defined(OMEGA_H_USE_OPENMP)
+constexpr bool enable_atomics = true;
 #else
 constexpr bool enable_atomics = false;
 #endif
@@ -64,6 +108,13 @@ OMEGA_H_INLINE T atomic_fetch_add(volatile T* const dest, const T val) {
   return Atomics<enable_atomics>::fetch_add<T>(dest, val);
 }
 
+/* stores (val) if (*dest == compare), returns the old value of (*dest) */
+template <typename T>
+OMEGA_H_INLINE T atomic_compare_exchange(
+    volatile T* const dest, const T compare, const T val) {
+  return Atomics<enable_atomics>::compare_exchange<T>(dest, compare, val);
+}
+
 }  // end namespace Omega_h
 
 #endif
@@ -38,6 +38,14 @@ enum Omega_h_Parting {
   OMEGA_H_VERT_BASED,
 };
 
+// how Mesh::balance() decides where elements go
+enum Omega_h_Balance {
+  OMEGA_H_RIB,          // recursive inertial bisection of element centers
+  OMEGA_H_GRAPH_CUT,    // multilevel dual graph partition, fewest cut sides
+  OMEGA_H_GRAPH_VOLUME, // same, fewest part neighbors summed over elements
+  OMEGA_H_DIFFUSE,      // move boundary elements between neighbor ranks
+};
+
 enum Omega_h_Source {
   OMEGA_H_CONSTANT,
   OMEGA_H_VARIATION,
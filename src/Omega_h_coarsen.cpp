@@ -7,8 +7,10 @@
 #include "Omega_h_indset.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
+#include "Omega_h_mark.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_modify.hpp"
+#include "Omega_h_shape.hpp"
 #include "Omega_h_transfer.hpp"
 
 namespace Omega_h {
@@ -194,10 +196,17 @@ static bool coarsen_ents(Mesh* mesh, AdaptOpts const& opts, Int ent_dim,
 bool coarsen_by_size(Mesh* mesh, AdaptOpts const& opts) {
   begin_code("coarsen_by_size");
   auto comm = mesh->comm();
-  auto lengths = mesh->ask_lengths();
-  auto edge_is_cand = each_lt(lengths, opts.min_length_desired);
-  auto ret = (get_max(comm, edge_is_cand) == 1);
+  auto dirty_edges =
+      collect_dirty(mesh, EDGE, COARSEN_DIRTY, opts.ndirty_layers);
+  clean_dirty(mesh, COARSEN_DIRTY);
+  auto lengths = mesh->has_tag(EDGE, "length")
+                     ? unmap(dirty_edges, mesh->ask_lengths(), 1)
+                     : measure_edges_metric(mesh, dirty_edges);
+  auto dirty_edge_is_cand = each_lt(lengths, opts.min_length_desired);
+  auto ret = (get_max(comm, dirty_edge_is_cand) == 1);
   if (ret) {
+    auto edge_is_cand =
+        map_onto(dirty_edge_is_cand, dirty_edges, mesh->nedges(), I8(0), 1);
     ret = coarsen_ents(mesh, opts, EDGE, edge_is_cand, DESIRED, DONT_IMPROVE);
   }
   end_code();
@@ -211,8 +220,19 @@ bool coarsen_slivers(Mesh* mesh, AdaptOpts const& opts) {
   auto elems_are_cands =
       mark_sliver_layers(mesh, opts.min_quality_desired, opts.nsliver_layers);
   OMEGA_H_CHECK(get_max(comm, elems_are_cands) == 1);
-  auto ret = coarsen_ents(
-      mesh, opts, mesh->dim(), elems_are_cands, ALLOWED, IMPROVE_LOCALLY);
+  /* an element can also become a candidate when a change
+     within the sliver layers makes a new sliver */
+  auto dirty_elems = collect_dirty(mesh, mesh->dim(), SLIVER_DIRTY,
+      opts.ndirty_layers + opts.nsliver_layers);
+  clean_dirty(mesh, SLIVER_DIRTY);
+  auto dirty_elem_is_cand = unmap(dirty_elems, elems_are_cands, 1);
+  auto ret = (get_max(comm, dirty_elem_is_cand) == 1);
+  if (ret) {
+    elems_are_cands = map_onto(
+        dirty_elem_is_cand, dirty_elems, mesh->nelems(), I8(0), 1);
+    ret = coarsen_ents(
+        mesh, opts, mesh->dim(), elems_are_cands, ALLOWED, IMPROVE_LOCALLY);
+  }
   end_code();
   return ret;
 }
@@ -18,7 +18,6 @@ static Reals compute_flip_normals_dim(
     Bytes verts_matter,
     Real simple_algorithm_threshold = 0.95) { // constant given by Aubry and Lohner
   constexpr auto side_dim = dim - 1;
-  constexpr auto max_adj_sides = AvgDegree<side_dim, VERT, side_dim>::value * 2;
   auto v2s = mesh->ask_up(VERT, side_dim);
   auto sv2v = mesh->ask_verts_of(side_dim);
   auto verts_that_matter = collect_marked(verts_matter);
@@ -27,7 +26,7 @@ static Reals compute_flip_normals_dim(
   auto f = OMEGA_H_LAMBDA(LO vm) {
     auto v = verts_that_matter[vm];
     auto N_c = zero_vector<dim>();
-    Few<Vector<dim>, max_adj_sides> N;
+    Few<Vector<dim>, AvgDegree<dim - 1, VERT, dim - 1>::value * 2> N;
     auto n = 0;
     for (auto vs = v2s.a2ab[v]; vs < v2s.a2ab[v + 1]; ++vs) {
       auto s = v2s.ab2b[vs];
@@ -1,12 +1,28 @@
 #include "Omega_h_comm.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
+
+#ifndef OMEGA_H_USE_MPI
+#include <atomic>
+#include <thread>
+#if defined(OMEGA_H_USE_OPENMP) && !defined(OMEGA_H_USE_KOKKOSCORE)
+#include <omp.h>
+#endif
+#endif
 
 #include "Omega_h_array_ops.hpp"
+#include "Omega_h_control.hpp"
+#include "Omega_h_profile.hpp"
 #include "Omega_h_scan.hpp"
+#include "Omega_h_timer.hpp"
 
-#if defined(OMEGA_H_USE_CUDA) && !defined(OMEGA_H_USE_CUDA_AWARE_MPI)
 #include "Omega_h_library.hpp"
+
+#if defined(OMEGA_H_USE_CUDA) && !defined(OMEGA_H_USE_CUDA_AWARE_MPI)
 #include "Omega_h_loop.hpp"
 #endif
 
@@ -16,18 +32,336 @@ namespace Omega_h {
 
 #ifdef OMEGA_H_USE_MPI
 #define CALL(f) OMEGA_H_CHECK(MPI_SUCCESS == (f))
+#if MPI_VERSION >= 3 && !defined(OMEGA_H_USE_CUDA)
+#define OMEGA_H_NODE_EXCHANGE
+#endif
+#endif
+
+#ifndef OMEGA_H_USE_MPI
+
+/* the shared state of the ranks created by run_thread_ranks().
+   every collective operation has each rank publish a pointer
+   to its own data in its mailbox, wait for all ranks to do so,
+   read from the mailboxes of the ranks it needs data from,
+   and wait again before the published data may go away.
+   the mailboxes are plain pointers ordered by the atomic
+   counters of the barrier, so no locks are taken */
+
+class ThreadGroup {
+ public:
+  explicit ThreadGroup(I32 size)
+      : mailboxes_(std::size_t(size), nullptr), arrived_(0), generation_(0) {}
+  I32 size() const { return I32(mailboxes_.size()); }
+  /* the returned mailboxes stay valid until the next barrier() */
+  void const* const* publish(I32 rank, void const* data) {
+    mailboxes_[std::size_t(rank)] = data;
+    barrier();
+    return mailboxes_.data();
+  }
+  void barrier() {
+    auto generation = generation_.load(std::memory_order_acquire);
+    if (arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 == size()) {
+      arrived_.store(0, std::memory_order_relaxed);
+      generation_.fetch_add(1, std::memory_order_release);
+    } else {
+      while (generation_.load(std::memory_order_acquire) == generation) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+ private:
+  std::vector<void const*> mailboxes_;
+  std::atomic<I32> arrived_;
+  std::atomic<I32> generation_;
+};
+
+typedef std::shared_ptr<ThreadGroup> ThreadGroupPtr;
+
+/* collectively creates a new group for a communicator
+   derived from one containing the same threads */
+static ThreadGroupPtr share_group(ThreadGroup* threads, I32 rank) {
+  ThreadGroupPtr group;
+  if (rank == 0) group = std::make_shared<ThreadGroup>(threads->size());
+  auto mailboxes = threads->publish(rank, &group);
+  if (rank != 0) group = *static_cast<ThreadGroupPtr const*>(mailboxes[0]);
+  threads->barrier();
+  return group;
+}
+
+template <typename T>
+static T reduce_op(T a, T b, Omega_h_Op op) {
+  switch (op) {
+    case OMEGA_H_MIN:
+      return std::min(a, b);
+    case OMEGA_H_MAX:
+      return std::max(a, b);
+    case OMEGA_H_SUM:
+      return static_cast<T>(a + b);
+  }
+  OMEGA_H_NORETURN(a);
+}
+
+/* what a thread rank publishes for a neighbor exchange */
+struct ThreadOutbox {
+  HostRead<I32> const* destinations;
+  LO const* sdispls;
+  void const* data;
+};
+
+/* the index into the destinations of (outbox) of the message to (rank)
+   which is the (nth) one (counting from zero) to go from there to here */
+static LO find_message(ThreadOutbox const& outbox, I32 rank, LO nth) {
+  auto& destinations = *outbox.destinations;
+  for (LO j = 0; j < destinations.size(); ++j) {
+    if (destinations[j] == rank && nth-- == 0) return j;
+  }
+  Omega_h_fail("thread rank %d is not a destination of its source\n", rank);
+}
+
+#endif
+
+#ifdef OMEGA_H_USE_MPI
+
+class NodeWindow {
+ public:
+#ifdef OMEGA_H_NODE_EXCHANGE
+  NodeWindow(MPI_Comm comm, std::size_t bytes) : bytes_(bytes) {
+    CALL(MPI_Comm_split_type(
+        comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_));
+    char* base;
+    CALL(MPI_Win_allocate_shared(MPI_Aint(bytes), 1, MPI_INFO_NULL, node_,
+        &base, &win_));
+    CALL(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+    int size;
+    CALL(MPI_Comm_size(node_, &size));
+    segments_.resize(std::size_t(size));
+    for (int r = 0; r < size; ++r) {
+      MPI_Aint segment_bytes;
+      int disp_unit;
+      CALL(MPI_Win_shared_query(
+          win_, r, &segment_bytes, &disp_unit, &segments_[std::size_t(r)]));
+    }
+  }
+  ~NodeWindow() {
+    CALL(MPI_Win_unlock_all(win_));
+    CALL(MPI_Win_free(&win_));
+    CALL(MPI_Comm_free(&node_));
+  }
+  MPI_Comm comm() const { return node_; }
+  std::size_t bytes() const { return bytes_; }
+  char* segment(int node_rank) const {
+    return static_cast<char*>(segments_[std::size_t(node_rank)]);
+  }
+  /* makes the writes of each rank to its segment visible to the
+     others, over the ranks of (node) */
+  void sync(MPI_Comm node) const {
+    CALL(MPI_Win_sync(win_));
+    CALL(MPI_Barrier(node));
+    CALL(MPI_Win_sync(win_));
+  }
+
+ private:
+  MPI_Comm node_;
+  MPI_Win win_;
+  std::size_t bytes_;
+  std::vector<void*> segments_;
+#endif
+};
+
+std::shared_ptr<NodeWindow> make_node_window(
+    CommPtr comm, std::size_t bytes) {
+#ifdef OMEGA_H_NODE_EXCHANGE
+  /* a segment must at least hold the count of its messages */
+  if (bytes < sizeof(I64)) return std::shared_ptr<NodeWindow>();
+  return std::make_shared<NodeWindow>(comm->get_impl(), bytes);
+#else
+  (void)comm;
+  (void)bytes;
+  return std::shared_ptr<NodeWindow>();
+#endif
+}
+
+/* the neighbors of one graph Comm which share its node,
+   as ranks of the node window, or -1 for the others */
+class NodeExchange {
+ public:
+#ifdef OMEGA_H_NODE_EXCHANGE
+  NodeExchange(NodeWindow* window_in, MPI_Comm comm, HostRead<I32> sources,
+      HostRead<I32> destinations)
+      : window(window_in) {
+    CALL(MPI_Comm_split_type(
+        comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node));
+    MPI_Group group;
+    MPI_Group window_group;
+    CALL(MPI_Comm_group(comm, &group));
+    CALL(MPI_Comm_group(window->comm(), &window_group));
+    CALL(MPI_Comm_rank(window->comm(), &window_rank));
+    srcs.resize(std::size_t(sources.size()));
+    dsts.resize(std::size_t(destinations.size()));
+    CALL(MPI_Group_translate_ranks(group, sources.size(),
+        nonnull(sources.data()), window_group, nonnull(srcs.data())));
+    CALL(MPI_Group_translate_ranks(group, destinations.size(),
+        nonnull(destinations.data()), window_group, nonnull(dsts.data())));
+    /* messages to this rank itself gain nothing from the window */
+    for (auto& r : srcs) {
+      if (r == MPI_UNDEFINED || r == window_rank) r = -1;
+    }
+    for (auto& r : dsts) {
+      if (r == MPI_UNDEFINED || r == window_rank) r = -1;
+    }
+    CALL(MPI_Group_free(&group));
+    CALL(MPI_Group_free(&window_group));
+  }
+  ~NodeExchange() { CALL(MPI_Comm_free(&node)); }
+  bool has_neighbors() const {
+    for (auto r : srcs) {
+      if (r >= 0) return true;
+    }
+    for (auto r : dsts) {
+      if (r >= 0) return true;
+    }
+    return false;
+  }
+  NodeWindow* window;
+  /* the ranks of the Comm on this node */
+  MPI_Comm node;
+  int window_rank;
+  std::vector<int> srcs;
+  std::vector<int> dsts;
+#endif
+};
+
+#ifdef OMEGA_H_NODE_EXCHANGE
+
+/* each segment of the node window starts with the number of
+   messages in it, or -1 if they were sent through MPI because
+   they did not fit, followed by one of these per message */
+struct NodeMessage {
+  I64 offset;
+  I64 bytes;
+  I32 dst;
+  I32 padding;
+};
+
+/* where the message to each destination goes in the segment of the
+   node window, after the header, or -1 for destinations off the node.
+   the last entry is where the messages end */
+static std::vector<I64> node_layout(
+    NodeExchange const& node, int width, int const sdispls[], int entry_bytes) {
+  I64 nmsgs = 0;
+  for (auto r : node.dsts) nmsgs += (r >= 0);
+  std::vector<I64> offsets(node.dsts.size() + 1, -1);
+  auto offset = I64(sizeof(I64)) + nmsgs * I64(sizeof(NodeMessage));
+  for (std::size_t j = 0; j < node.dsts.size(); ++j) {
+    if (node.dsts[j] < 0) continue;
+    offsets[j] = offset;
+    offset += I64(sdispls[j + 1] - sdispls[j]) * I64(width) * I64(entry_bytes);
+  }
+  offsets.back() = offset;
+  return offsets;
+}
+
+/* the part of a blocking alltoallv() between neighbors on the same
+   node. each rank copies its messages into its own segment of the node
+   window, unless (packed) says they were already put there, and after
+   a barrier every rank copies the messages for it straight out of the
+   segments of their senders.
+   the second barrier lets the segments be reused by the next exchange.
+   because of the barriers, split-phase exchanges never come here */
+static void node_alltoallv(NodeExchange const& node, int width,
+    char const* sendbuf, int const sdispls[], char* recvbuf,
+    int const rdispls[], int entry_bytes, MPI_Comm comm,
+    HostRead<I32> sources, HostRead<I32> destinations,
+    std::vector<MPI_Request>* requests, bool packed) {
+  int const tag = 42;
+  auto message_bytes = [=](int const displs[], std::size_t i) {
+    return I64(displs[i + 1] - displs[i]) * I64(width) * I64(entry_bytes);
+  };
+  auto offsets = node_layout(node, width, sdispls, entry_bytes);
+  auto window = node.window;
+  auto segment = window->segment(node.window_rank);
+  auto messages = reinterpret_cast<NodeMessage*>(segment + sizeof(I64));
+  if (offsets.back() <= I64(window->bytes())) {
+    I64 nmsgs = 0;
+    for (auto r : node.dsts) nmsgs += (r >= 0);
+    std::memcpy(segment, &nmsgs, sizeof(I64));
+    for (std::size_t j = 0; j < node.dsts.size(); ++j) {
+      if (node.dsts[j] < 0) continue;
+      NodeMessage message;
+      message.offset = offsets[j];
+      message.bytes = message_bytes(sdispls, j);
+      message.dst = node.dsts[j];
+      message.padding = 0;
+      std::memcpy(messages++, &message, sizeof(NodeMessage));
+      if (packed) continue;
+      std::memcpy(segment + message.offset,
+          sendbuf + I64(sdispls[j]) * I64(width) * I64(entry_bytes),
+          std::size_t(message.bytes));
+    }
+  } else {
+    OMEGA_H_CHECK(!packed);
+    I64 const sent_through_mpi = -1;
+    std::memcpy(segment, &sent_through_mpi, sizeof(I64));
+    for (std::size_t j = 0; j < node.dsts.size(); ++j) {
+      if (node.dsts[j] < 0) continue;
+      requests->push_back(MPI_REQUEST_NULL);
+      CALL(MPI_Isend(sendbuf + I64(sdispls[j]) * I64(width) * I64(entry_bytes),
+          int(message_bytes(sdispls, j)), MPI_BYTE, destinations[LO(j)], tag,
+          comm, &requests->back()));
+    }
+  }
+  window->sync(node.node);
+  for (std::size_t i = 0; i < node.srcs.size(); ++i) {
+    if (node.srcs[i] < 0) continue;
+    auto dest = recvbuf + I64(rdispls[i]) * I64(width) * I64(entry_bytes);
+    auto expected = message_bytes(rdispls, i);
+    auto theirs = window->segment(node.srcs[i]);
+    I64 ntheirs;
+    std::memcpy(&ntheirs, theirs, sizeof(I64));
+    if (ntheirs < 0) {
+      requests->push_back(MPI_REQUEST_NULL);
+      CALL(MPI_Irecv(dest, int(expected), MPI_BYTE, sources[LO(i)], tag, comm,
+          &requests->back()));
+      continue;
+    }
+    /* the nth message from that source is the nth one it has for us */
+    I64 nth = 0;
+    for (std::size_t i2 = 0; i2 < i; ++i2) {
+      nth += (node.srcs[i2] == node.srcs[i]);
+    }
+    auto their_messages =
+        reinterpret_cast<NodeMessage const*>(theirs + sizeof(I64));
+    I64 k = 0;
+    NodeMessage message;
+    for (; k < ntheirs; ++k) {
+      std::memcpy(&message, their_messages + k, sizeof(NodeMessage));
+      if (message.dst == node.window_rank && nth-- == 0) break;
+    }
+    OMEGA_H_CHECK(k < ntheirs);
+    OMEGA_H_CHECK(message.bytes == expected);
+    std::memcpy(dest, theirs + message.offset, std::size_t(message.bytes));
+  }
+  window->sync(node.node);
+}
+
+#endif
+
 #endif
 
 Comm::Comm() {
 #ifdef OMEGA_H_USE_MPI
   impl_ = MPI_COMM_NULL;
+  node_checked_ = false;
+#else
+  rank_ = 0;
 #endif
   library_ = nullptr;
 }
 
 #ifdef OMEGA_H_USE_MPI
 Comm::Comm(Library* library_in, MPI_Comm impl_in)
-    : impl_(impl_in), library_(library_in) {
+    : impl_(impl_in), node_checked_(false), library_(library_in) {
   int topo_type;
   CALL(MPI_Topo_test(impl_in, &topo_type));
   if (topo_type == MPI_DIST_GRAPH) {
@@ -48,7 +382,7 @@ Comm::Comm(Library* library_in, MPI_Comm impl_in)
 }
 #else
 Comm::Comm(Library* library_in, bool is_graph, bool sends_to_self)
-    : library_(library_in) {
+    : rank_(0), library_(library_in) {
   if (is_graph) {
     if (sends_to_self) {
       srcs_ = Read<LO>({0});
@@ -64,6 +398,20 @@ Comm::Comm(Library* library_in, bool is_graph, bool sends_to_self)
     OMEGA_H_CHECK(!sends_to_self);
   }
 }
+
+Comm::Comm(Library* library_in, std::shared_ptr<ThreadGroup> threads_in,
+    I32 rank_in, Read<I32> srcs_in, Read<I32> dsts_in)
+    : threads_(threads_in), rank_(rank_in), library_(library_in) {
+  self_src_ = self_dst_ = -1;
+  if (srcs_in.exists()) {
+    srcs_ = srcs_in;
+    dsts_ = dsts_in;
+    self_src_ = find_last(srcs_, rank_);
+    self_dst_ = find_last(dsts_, rank_);
+    host_srcs_ = HostRead<I32>(srcs_);
+    host_dsts_ = HostRead<I32>(dsts_);
+  }
+}
 #endif
 
 Comm::~Comm() {
@@ -80,7 +428,7 @@ I32 Comm::rank() const {
   CALL(MPI_Comm_rank(impl_, &r));
   return r;
 #else
-  return 0;
+  return rank_;
 #endif
 }
 
@@ -90,7 +438,7 @@ I32 Comm::size() const {
   CALL(MPI_Comm_size(impl_, &s));
   return s;
 #else
-  return 1;
+  return threads_ ? threads_->size() : 1;
 #endif
 }
 
@@ -100,6 +448,10 @@ CommPtr Comm::dup() const {
   CALL(MPI_Comm_dup(impl_, &impl2));
   return CommPtr(new Comm(library_, impl2));
 #else
+  if (threads_) {
+    auto group = share_group(threads_.get(), rank_);
+    return CommPtr(new Comm(library_, group, rank_, srcs_, dsts_));
+  }
   return CommPtr(
       new Comm(library_, srcs_.exists(), srcs_.exists() && srcs_.size() == 1));
 #endif
@@ -111,6 +463,33 @@ CommPtr Comm::split(I32 color, I32 key) const {
   CALL(MPI_Comm_split(impl_, color, key, &impl2));
   return CommPtr(new Comm(library_, impl2));
 #else
+  if (threads_) {
+    /* order the members of each color by key, then by old rank,
+       and have the first one create the group of that color */
+    I32 mine[2] = {color, key};
+    auto mailboxes = threads_->publish(rank_, mine);
+    std::vector<std::pair<I32, I32>> members;
+    for (I32 r = 0; r < threads_->size(); ++r) {
+      auto theirs = static_cast<I32 const*>(mailboxes[r]);
+      if (theirs[0] == color) members.push_back(std::make_pair(theirs[1], r));
+    }
+    threads_->barrier();
+    std::sort(members.begin(), members.end());
+    I32 new_rank = 0;
+    while (members[std::size_t(new_rank)].second != rank_) ++new_rank;
+    ThreadGroupPtr group;
+    if (new_rank == 0) {
+      group = std::make_shared<ThreadGroup>(I32(members.size()));
+    }
+    mailboxes = threads_->publish(rank_, &group);
+    if (new_rank != 0) {
+      group = *static_cast<ThreadGroupPtr const*>(
+          mailboxes[members.front().second]);
+    }
+    threads_->barrier();
+    return CommPtr(
+        new Comm(library_, group, new_rank, Read<I32>(), Read<I32>()));
+  }
   (void)color;
   (void)key;
   return CommPtr(new Comm(library_, false, false));
@@ -130,6 +509,25 @@ CommPtr Comm::graph(Read<I32> dsts) const {
       reorder, &impl2));
   return CommPtr(new Comm(library_, impl2));
 #else
+  if (threads_) {
+    /* the sources are the ranks sending here, in increasing order */
+    auto group = share_group(threads_.get(), rank_);
+    HostRead<I32> h_destinations(dsts);
+    auto mailboxes = threads_->publish(rank_, &h_destinations);
+    std::vector<I32> sources;
+    for (I32 r = 0; r < threads_->size(); ++r) {
+      auto& theirs = *static_cast<HostRead<I32> const*>(mailboxes[r]);
+      for (LO j = 0; j < theirs.size(); ++j) {
+        if (theirs[j] == rank_) sources.push_back(r);
+      }
+    }
+    threads_->barrier();
+    HostWrite<I32> h_sources(LO(sources.size()));
+    for (LO i = 0; i < h_sources.size(); ++i) {
+      h_sources[i] = sources[std::size_t(i)];
+    }
+    return CommPtr(new Comm(library_, group, rank_, h_sources.write(), dsts));
+  }
   return CommPtr(new Comm(library_, true, dsts.size() == 1));
 #endif
 }
@@ -146,6 +544,10 @@ CommPtr Comm::graph_adjacent(Read<I32> srcs, Read<I32> dsts) const {
       reorder, &impl2));
   return CommPtr(new Comm(library_, impl2));
 #else
+  if (threads_) {
+    auto group = share_group(threads_.get(), rank_);
+    return CommPtr(new Comm(library_, group, rank_, srcs, dsts));
+  }
   OMEGA_H_CHECK(srcs == dsts);
   return CommPtr(new Comm(library_, true, dsts.size() == 1));
 #endif
@@ -159,12 +561,37 @@ Read<I32> Comm::sources() const { return srcs_; }
 
 Read<I32> Comm::destinations() const { return dsts_; }
 
+#ifdef OMEGA_H_USE_MPI
+/* a collective counts as one message to every other rank,
+   and since it synchronizes, all of its time is waiting */
+static void add_collective_profile(
+    Comm const* comm, std::size_t nbytes, Now t0) {
+  if (!profile::global_singleton_history) return;
+  auto t1 = now();
+  auto nothers = std::size_t(comm->size() - 1);
+  profile::simple_add_comm(nothers ? 1 : 0, nothers ? nbytes : 0, nothers);
+  profile::simple_add_wait(t1 - t0);
+}
+#endif
+
 template <typename T>
 T Comm::allreduce(T x, Omega_h_Op op) const {
 #ifdef OMEGA_H_USE_MPI
+  auto t0 = now();
   CALL(MPI_Allreduce(
       MPI_IN_PLACE, &x, 1, MpiTraits<T>::datatype(), mpi_op(op), impl_));
+  add_collective_profile(this, sizeof(T), t0);
 #else
+  if (threads_) {
+    /* every rank combines in the same order, for identical results */
+    auto mailboxes = threads_->publish(rank_, &x);
+    auto y = *static_cast<T const*>(mailboxes[0]);
+    for (I32 r = 1; r < threads_->size(); ++r) {
+      y = reduce_op(y, *static_cast<T const*>(mailboxes[r]), op);
+    }
+    threads_->barrier();
+    return y;
+  }
   (void)op;
 #endif
   return x;
@@ -197,6 +624,16 @@ Int128 Comm::add_int128(Int128 x) const {
   CALL(MPI_Op_create(mpi_add_int128, commute, &op));
   CALL(MPI_Allreduce(MPI_IN_PLACE, &x, sizeof(Int128), MPI_PACKED, op, impl_));
   CALL(MPI_Op_free(&op));
+#else
+  if (threads_) {
+    auto mailboxes = threads_->publish(rank_, &x);
+    auto y = *static_cast<Int128 const*>(mailboxes[0]);
+    for (I32 r = 1; r < threads_->size(); ++r) {
+      y = y + *static_cast<Int128 const*>(mailboxes[r]);
+    }
+    threads_->barrier();
+    return y;
+  }
 #endif
   return x;
 }
@@ -204,11 +641,23 @@ Int128 Comm::add_int128(Int128 x) const {
 template <typename T>
 T Comm::exscan(T x, Omega_h_Op op) const {
 #ifdef OMEGA_H_USE_MPI
+  auto t0 = now();
   CALL(MPI_Exscan(
       MPI_IN_PLACE, &x, 1, MpiTraits<T>::datatype(), mpi_op(op), impl_));
+  add_collective_profile(this, sizeof(T), t0);
   if (rank() == 0) x = 0;
   return x;
 #else
+  if (threads_) {
+    auto mailboxes = threads_->publish(rank_, &x);
+    T y = 0;
+    for (I32 r = 0; r < rank_; ++r) {
+      auto theirs = *static_cast<T const*>(mailboxes[r]);
+      y = (r == 0) ? theirs : reduce_op(y, theirs, op);
+    }
+    threads_->barrier();
+    return y;
+  }
   (void)op;
   (void)x;
   return 0;
@@ -220,7 +669,11 @@ void Comm::bcast(T& x) const {
 #ifdef OMEGA_H_USE_MPI
   CALL(MPI_Bcast(&x, 1, MpiTraits<T>::datatype(), 0, impl_));
 #else
-  (void)x;
+  if (threads_) {
+    auto mailboxes = threads_->publish(rank_, &x);
+    if (rank_ != 0) x = *static_cast<T const*>(mailboxes[0]);
+    threads_->barrier();
+  }
 #endif
 }
 
@@ -231,7 +684,11 @@ void Comm::bcast_string(std::string& s) const {
   s.resize(static_cast<std::size_t>(len));
   CALL(MPI_Bcast(&s[0], len, MPI_CHAR, 0, impl_));
 #else
-  (void)s;
+  if (threads_) {
+    auto mailboxes = threads_->publish(rank_, &s);
+    if (rank_ != 0) s = *static_cast<std::string const*>(mailboxes[0]);
+    threads_->barrier();
+  }
 #endif
 }
 
@@ -313,15 +770,23 @@ static int Neighbor_alltoall(HostRead<I32> sources, HostRead<I32> destinations,
 #endif  // end if MPI_VERSION < 3
 }
 
-/* custom implementation of MPI_Neighbor_alltoallv
+/* custom implementation of MPI_Ineighbor_alltoallv
  * this used to be here as a workaround, but now allows us to precompute
- * fewer things
+ * fewer things.
+ * the requests for all receives and sends are appended to (requests),
+ * and the buffers must stay alive until those complete.
+ * if (persistent) is true, the requests are only created,
+ * to be started any number of times by MPI_Startall.
+ * neighbors on this node according to (node), if any, are left out
+ * for node_alltoallv()
  */
 
-static int Neighbor_alltoallv(HostRead<I32> sources, HostRead<I32> destinations,
-    int width, const void* sendbuf, const int sdispls[], MPI_Datatype sendtype,
-    void* recvbuf, const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm) {
-  // begin_code("Neighbor_alltoallv");
+static int Ineighbor_alltoallv(HostRead<I32> sources,
+    HostRead<I32> destinations, int width, const void* sendbuf,
+    const int sdispls[], MPI_Datatype sendtype, void* recvbuf,
+    const int rdispls[], MPI_Datatype recvtype, MPI_Comm comm,
+    std::vector<MPI_Request>* requests, NodeExchange const* node,
+    bool persistent = false) {
   int const tag = 42;
   int indegree, outdegree;
   indegree = sources.size();
@@ -330,24 +795,53 @@ static int Neighbor_alltoallv(HostRead<I32> sources, HostRead<I32> destinations,
   CALL(MPI_Type_size(sendtype, &sendwidth));
   int recvwidth;
   CALL(MPI_Type_size(sendtype, &recvwidth));
-  MPI_Request* recvreqs = new MPI_Request[indegree];
+  auto recv = persistent ? MPI_Recv_init : MPI_Irecv;
+  auto send = persistent ? MPI_Send_init : MPI_Isend;
   for (int i = 0; i < indegree; ++i) {
-    CALL(MPI_Irecv(static_cast<char*>(recvbuf) + rdispls[i] * recvwidth * width,
+#ifdef OMEGA_H_NODE_EXCHANGE
+    if (node && node->srcs[std::size_t(i)] >= 0) continue;
+#endif
+    requests->push_back(MPI_REQUEST_NULL);
+    CALL(recv(static_cast<char*>(recvbuf) + rdispls[i] * recvwidth * width,
         (rdispls[i + 1] - rdispls[i]) * width, recvtype, sources[i], tag, comm,
-        recvreqs + i));
+        &requests->back()));
   }
   for (int i = 0; i < outdegree; ++i) {
-    CALL(MPI_Send(
+#ifdef OMEGA_H_NODE_EXCHANGE
+    if (node && node->dsts[std::size_t(i)] >= 0) continue;
+#endif
+    requests->push_back(MPI_REQUEST_NULL);
+    CALL(send(
         static_cast<char const*>(sendbuf) + sdispls[i] * sendwidth * width,
         (sdispls[i + 1] - sdispls[i]) * width, sendtype, destinations[i], tag,
-        comm));
+        comm, &requests->back()));
   }
-  CALL(MPI_Waitall(indegree, recvreqs, MPI_STATUSES_IGNORE));
-  delete[] recvreqs;
-  // end_code();
+#ifndef OMEGA_H_NODE_EXCHANGE
+  (void)node;
+#endif
   return MPI_SUCCESS;
 }
 
+NodeExchange const* Comm::node_exchange() const {
+#ifdef OMEGA_H_NODE_EXCHANGE
+  /* all ranks of this Comm take part, so that those on
+     the same node can agree to skip it if none of them
+     have neighbors on the node */
+  if (!node_checked_) {
+    node_checked_ = true;
+    auto window = library_ ? library_->node_window() : nullptr;
+    if (window) {
+      auto node = std::make_shared<NodeExchange>(
+          window, impl_, host_srcs_, host_dsts_);
+      int any = node->has_neighbors();
+      CALL(MPI_Allreduce(MPI_IN_PLACE, &any, 1, MPI_INT, MPI_MAX, node->node));
+      if (any) node_ = node;
+    }
+  }
+#endif
+  return node_.get();
+}
+
 #endif  // end ifdef OMEGA_H_USE_MPI
 
 template <typename T>
@@ -359,6 +853,15 @@ Read<T> Comm::allgather(T x) const {
       MpiTraits<T>::datatype(), impl_));
   return recvbuf.write();
 #else
+  if (threads_) {
+    auto mailboxes = threads_->publish(rank_, &x);
+    HostWrite<T> recvbuf(host_srcs_.size());
+    for (LO i = 0; i < recvbuf.size(); ++i) {
+      recvbuf[i] = *static_cast<T const*>(mailboxes[host_srcs_[i]]);
+    }
+    threads_->barrier();
+    return recvbuf.write();
+  }
   if (srcs_.size() == 1) return Read<T>({x});
   return Read<T>({});
 #endif
@@ -374,6 +877,10 @@ Read<T> Comm::alltoall(Read<T> x) const {
       MpiTraits<T>::datatype(), impl_));
   return recvbuf.write();
 #else
+  if (threads_) {
+    return alltoallv(x, LOs(dsts_.size() + 1, 0, 1),
+        LOs(srcs_.size() + 1, 0, 1), 1);
+  }
   return x;
 #endif
 }
@@ -459,9 +966,14 @@ void self_send_part2(
 #endif
 
 template <typename T>
-Read<T> Comm::alltoallv(Read<T> sendbuf_dev, Read<LO> sdispls_dev,
+Future<T> Comm::ialltoallv(Read<T> sendbuf_dev, Read<LO> sdispls_dev,
     Read<LO> rdispls_dev, Int width) const {
-// begin_code("Comm::alltoallv");
+  return start_alltoallv(sendbuf_dev, sdispls_dev, rdispls_dev, width, false);
+}
+
+template <typename T>
+Future<T> Comm::start_alltoallv(Read<T> sendbuf_dev, Read<LO> sdispls_dev,
+    Read<LO> rdispls_dev, Int width, bool on_node) const {
 #ifdef OMEGA_H_USE_MPI
 #if defined(OMEGA_H_USE_CUDA) && !defined(OMEGA_H_USE_CUDA_AWARE_MPI)
   auto self_data = self_send_part1(self_dst_, self_src_, &sendbuf_dev,
@@ -471,38 +983,224 @@ Read<T> Comm::alltoallv(Read<T> sendbuf_dev, Read<LO> sdispls_dev,
   HostRead<LO> rdispls(rdispls_dev);
   OMEGA_H_CHECK(sendbuf_dev.size() == sdispls.last() * width);
   int nrecvd = rdispls.last() * width;
+  typename Future<T>::requests_type requests;
 #if defined(OMEGA_H_USE_CUDA) && !defined(OMEGA_H_USE_CUDA_AWARE_MPI)
+  (void)on_node;
   HostWrite<T> recvbuf(nrecvd);
   HostRead<T> sendbuf(sendbuf_dev);
-  CALL(Neighbor_alltoallv(host_srcs_, host_dsts_, width,
+  CALL(Ineighbor_alltoallv(host_srcs_, host_dsts_, width,
       nonnull(sendbuf.data()), nonnull(sdispls.data()),
       MpiTraits<T>::datatype(), nonnull(recvbuf.data()),
-      nonnull(rdispls.data()), MpiTraits<T>::datatype(), impl_));
-  auto recvbuf_dev = Read<T>(recvbuf.write());
-  self_send_part2(self_data, self_src_, &recvbuf_dev, rdispls_dev);
+      nonnull(rdispls.data()), MpiTraits<T>::datatype(), impl_, &requests,
+      nullptr));
+  add_profile(sdispls, width * Int(sizeof(T)));
+  auto self_src = self_src_;
+  auto finisher = [=]() {
+    (void)sendbuf;  // keeps the send buffer alive until the sends complete
+    auto recvbuf_dev = Read<T>(recvbuf.write());
+    self_send_part2(self_data, self_src, &recvbuf_dev, rdispls_dev);
+    return recvbuf_dev;
+  };
 #else   // !defined(OMEGA_H_USE_CUDA) || defined(OMEGA_H_USE_CUDA_AWARE_MPI)
   Write<T> recvbuf_dev_w(nrecvd);
-  CALL(Neighbor_alltoallv(host_srcs_, host_dsts_, width,
+  auto node = on_node ? node_exchange() : nullptr;
+  CALL(Ineighbor_alltoallv(host_srcs_, host_dsts_, width,
       nonnull(sendbuf_dev.data()), nonnull(sdispls.data()),
       MpiTraits<T>::datatype(), nonnull(recvbuf_dev_w.data()),
-      nonnull(rdispls.data()), MpiTraits<T>::datatype(), impl_));
-  Read<T> recvbuf_dev = recvbuf_dev_w;
+      nonnull(rdispls.data()), MpiTraits<T>::datatype(), impl_, &requests,
+      node));
+#ifdef OMEGA_H_NODE_EXCHANGE
+  /* messages off the node are on their way while these are copied */
+  if (node) {
+    node_alltoallv(*node, width,
+        reinterpret_cast<char const*>(nonnull(sendbuf_dev.data())),
+        nonnull(sdispls.data()),
+        reinterpret_cast<char*>(nonnull(recvbuf_dev_w.data())),
+        nonnull(rdispls.data()), int(sizeof(T)), impl_, host_srcs_,
+        host_dsts_, &requests, false);
+  }
+#endif
+  add_profile(sdispls, width * Int(sizeof(T)));
+  auto finisher = [=]() {
+    (void)sendbuf_dev;  // keeps the send buffer alive until the sends complete
+    return Read<T>(recvbuf_dev_w);
+  };
 #endif  // !defined(OMEGA_H_USE_CUDA) || defined(OMEGA_H_USE_CUDA_AWARE_MPI)
+  return Future<T>(std::move(requests), finisher);
 #else   // !defined(OMEGA_H_USE_MPI)
+  if (threads_) {
+    /* the thread ranks copy directly out of their sources'
+       send buffers, so the exchange completes right here */
+    HostRead<T> sendbuf(sendbuf_dev);
+    HostRead<LO> sdispls(sdispls_dev);
+    HostRead<LO> rdispls(rdispls_dev);
+    OMEGA_H_CHECK(sendbuf.size() == sdispls.last() * width);
+    ThreadOutbox mine = {&host_dsts_, nonnull(sdispls.data()),
+        nonnull(sendbuf.data())};
+    auto mailboxes = threads_->publish(rank_, &mine);
+    HostWrite<T> recvbuf(rdispls.last() * width);
+    for (LO i = 0; i < host_srcs_.size(); ++i) {
+      auto src = host_srcs_[i];
+      LO nth = 0;
+      for (LO i2 = 0; i2 < i; ++i2) nth += (host_srcs_[i2] == src);
+      auto& theirs = *static_cast<ThreadOutbox const*>(mailboxes[src]);
+      auto j = find_message(theirs, rank_, nth);
+      auto begin = theirs.sdispls[j];
+      auto count = theirs.sdispls[j + 1] - begin;
+      OMEGA_H_CHECK(count == rdispls[i + 1] - rdispls[i]);
+      auto from = static_cast<T const*>(theirs.data) + begin * width;
+      std::copy(from, from + count * width,
+          nonnull(recvbuf.data()) + rdispls[i] * width);
+    }
+    threads_->barrier();
+    return Future<T>(Read<T>(recvbuf.write()));
+  }
   (void)sdispls_dev;
   (void)rdispls_dev;
   (void)width;
-  auto recvbuf_dev = sendbuf_dev;
+  (void)on_node;
+  return Future<T>(sendbuf_dev);
 #endif  // !defined(OMEGA_H_USE_MPI)
-        // end_code();
-  return recvbuf_dev;
+}
+
+template <typename T>
+Read<T> Comm::alltoallv(Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls,
+    Int width) const {
+  return start_alltoallv(sendbuf, sdispls, rdispls, width, true).get();
+}
+
+#ifdef OMEGA_H_USE_MPI
+std::vector<MPI_Request> Comm::alltoallv_init(Write<I8> sendbuf_dev,
+    Read<LO> sdispls_dev, Write<I8> recvbuf_dev, Read<LO> rdispls_dev,
+    Int width, bool leave_node) const {
+  HostRead<LO> sdispls(sdispls_dev);
+  HostRead<LO> rdispls(rdispls_dev);
+  OMEGA_H_CHECK(sendbuf_dev.size() == sdispls.last() * width);
+  OMEGA_H_CHECK(recvbuf_dev.size() == rdispls.last() * width);
+  std::vector<MPI_Request> requests;
+  CALL(Ineighbor_alltoallv(host_srcs_, host_dsts_, width,
+      nonnull(sendbuf_dev.data()), nonnull(sdispls.data()),
+      MpiTraits<I8>::datatype(), nonnull(recvbuf_dev.data()),
+      nonnull(rdispls.data()), MpiTraits<I8>::datatype(), impl_, &requests,
+      leave_node ? node_exchange() : nullptr, true));
+  return requests;
+}
+
+bool Comm::has_node_exchange() const { return node_exchange() != nullptr; }
+
+void Comm::alltoallv_on_node(Write<I8> sendbuf, HostRead<LO> sdispls,
+    Write<I8> recvbuf, HostRead<LO> rdispls, Int width,
+    std::vector<MPI_Request>* requests, bool packed) const {
+#ifdef OMEGA_H_NODE_EXCHANGE
+  auto node = node_exchange();
+  if (!node) return;
+  node_alltoallv(*node, width,
+      reinterpret_cast<char const*>(nonnull(sendbuf.data())),
+      nonnull(sdispls.data()), reinterpret_cast<char*>(nonnull(recvbuf.data())),
+      nonnull(rdispls.data()), 1, impl_, host_srcs_, host_dsts_, requests,
+      packed);
+#else
+  (void)sendbuf;
+  (void)sdispls;
+  (void)recvbuf;
+  (void)rdispls;
+  (void)width;
+  (void)requests;
+  (void)packed;
+#endif
+}
+
+std::vector<I64> Comm::node_offsets(HostRead<LO> sdispls, Int width) const {
+#ifdef OMEGA_H_NODE_EXCHANGE
+  auto node = node_exchange();
+  if (!node) return std::vector<I64>();
+  auto offsets = node_layout(*node, width, nonnull(sdispls.data()), 1);
+  if (offsets.back() > I64(node->window->bytes())) return std::vector<I64>();
+  offsets.pop_back();
+  return offsets;
+#else
+  (void)sdispls;
+  (void)width;
+  return std::vector<I64>();
+#endif
+}
+
+I8* Comm::node_segment() const {
+#ifdef OMEGA_H_NODE_EXCHANGE
+  auto node = node_exchange();
+  if (!node) return nullptr;
+  return reinterpret_cast<I8*>(node->window->segment(node->window_rank));
+#else
+  return nullptr;
+#endif
+}
+#endif
+
+void Comm::add_profile(HostRead<LO> sdispls, Int entry_bytes) const {
+#ifdef OMEGA_H_USE_MPI
+  if (!profile::global_singleton_history) return;
+  /* messages to this rank itself are local copies, not communication */
+  std::size_t nmsgs = 0;
+  std::size_t nbytes = 0;
+  for (LO i = 0; i + 1 < sdispls.size(); ++i) {
+    if (i == self_dst_) continue;
+    auto count = std::size_t(sdispls[i + 1] - sdispls[i]);
+    if (count) ++nmsgs;
+    nbytes += count * std::size_t(entry_bytes);
+  }
+  auto nneighbors = std::size_t(host_dsts_.size() - (self_dst_ >= 0 ? 1 : 0));
+  profile::simple_add_comm(nmsgs, nbytes, nneighbors);
+#else
+  (void)sdispls;
+  (void)entry_bytes;
+#endif
 }
 
 void Comm::barrier() const {
 #ifdef OMEGA_H_USE_MPI
   CALL(MPI_Barrier(impl_));
+#else
+  if (threads_) threads_->barrier();
+#endif
+}
+
+#ifndef OMEGA_H_USE_MPI
+void run_thread_ranks(
+    Library* library, I32 nranks, std::function<void(CommPtr)> const& f) {
+  OMEGA_H_CHECK(nranks >= 1);
+#ifdef OMEGA_H_USE_KOKKOSCORE
+  OMEGA_H_CHECK(nranks == 1);
+#endif
+  /* the profiler keeps one global call stack,
+     and the memory log global counters and a global stacktrace */
+  OMEGA_H_CHECK(nranks == 1 || !profile::global_singleton_history);
+  OMEGA_H_CHECK(nranks == 1 || !should_log_memory);
+#if defined(OMEGA_H_USE_OPENMP) && !defined(OMEGA_H_USE_KOKKOSCORE)
+  /* each rank starts its own OpenMP team,
+     so the cores are split among them */
+  auto old_nthreads = omp_get_max_threads();
+  auto rank_nthreads = std::max(1, old_nthreads / nranks);
+#endif
+  auto threads = std::make_shared<ThreadGroup>(nranks);
+  std::vector<std::thread> others;
+  for (I32 rank = 1; rank < nranks; ++rank) {
+    others.emplace_back([=]() {
+#if defined(OMEGA_H_USE_OPENMP) && !defined(OMEGA_H_USE_KOKKOSCORE)
+      omp_set_num_threads(rank_nthreads);
+#endif
+      f(CommPtr(new Comm(library, threads, rank, Read<I32>(), Read<I32>())));
+    });
+  }
+#if defined(OMEGA_H_USE_OPENMP) && !defined(OMEGA_H_USE_KOKKOSCORE)
+  omp_set_num_threads(rank_nthreads);
+#endif
+  f(CommPtr(new Comm(library, threads, 0, Read<I32>(), Read<I32>())));
+  for (auto& thread : others) thread.join();
+#if defined(OMEGA_H_USE_OPENMP) && !defined(OMEGA_H_USE_KOKKOSCORE)
+  omp_set_num_threads(old_nthreads);
 #endif
 }
+#endif
 
 #undef CALL
 
@@ -513,6 +1211,8 @@ void Comm::barrier() const {
   template Read<T> Comm::allgather(T x) const;                                 \
   template Read<T> Comm::alltoall(Read<T> x) const;                            \
   template Read<T> Comm::alltoallv(                                            \
+      Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls, Int width) const;   \
+  template Future<T> Comm::ialltoallv(                                         \
       Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls, Int width) const;
 INST(I8)
 INST(I32)
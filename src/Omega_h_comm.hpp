@@ -1,11 +1,14 @@
 #ifndef OMEGA_H_COMM_HPP
 #define OMEGA_H_COMM_HPP
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include <Omega_h_c.h>
 #include <Omega_h_array.hpp>
 #include <Omega_h_defines.hpp>
+#include <Omega_h_future.hpp>
 #include <Omega_h_int128.hpp>
 
 namespace Omega_h {
@@ -14,12 +17,27 @@ static_assert(sizeof(int) == 4, "Omega_h::Comm assumes 32-bit int");
 
 class Library;
 class Comm;
+#ifdef OMEGA_H_USE_MPI
+class NodeWindow;
+class NodeExchange;
+#else
+class ThreadGroup;
+#endif
 
 typedef std::shared_ptr<Comm> CommPtr;
 
 class Comm {
 #ifdef OMEGA_H_USE_MPI
   MPI_Comm impl_;
+  /* how neighbors on this node are reached,
+     set up by the first exchange, see NodeWindow */
+  mutable std::shared_ptr<NodeExchange> node_;
+  mutable bool node_checked_;
+#else
+  /* set when the ranks are threads of this process,
+     see run_thread_ranks() */
+  std::shared_ptr<ThreadGroup> threads_;
+  I32 rank_;
 #endif
   Library* library_;
   Read<I32> srcs_;
@@ -36,6 +54,10 @@ class Comm {
   MPI_Comm get_impl() const { return impl_; }
 #else
   Comm(Library* library, bool is_graph, bool sends_to_self);
+  /* rank (rank) of a group of threads, with (srcs) and (dsts)
+     existing only for a graph communicator */
+  Comm(Library* library, std::shared_ptr<ThreadGroup> threads, I32 rank,
+      Read<I32> srcs, Read<I32> dsts);
 #endif
   ~Comm();
   Library* library() const;
@@ -65,9 +87,79 @@ class Comm {
   template <typename T>
   Read<T> alltoallv(
       Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls, Int width) const;
+  /* starts alltoallv() and returns without waiting for messages.
+     unlike alltoallv(), it never uses the node window,
+     whose exchanges need barriers between the ranks of the node */
+  template <typename T>
+  Future<T> ialltoallv(
+      Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls, Int width) const;
+#ifdef OMEGA_H_USE_MPI
+  /* persistent requests which, each time they are started with
+     MPI_Startall, do an alltoallv() between the two given buffers.
+     if (leave_node) is true, the messages between ranks of the
+     same node are left out, to be exchanged by alltoallv_on_node() */
+  std::vector<MPI_Request> alltoallv_init(Write<I8> sendbuf, Read<LO> sdispls,
+      Write<I8> recvbuf, Read<LO> rdispls, Int width,
+      bool leave_node = false) const;
+  /* the messages of an alltoallv_init() exchange between ranks
+     of the same node, which its persistent requests leave out.
+     it returns once they are copied, except that requests for any
+     of them sent through MPI after all are appended to (requests).
+     if (packed) is true, the caller already wrote those messages
+     at their node_offsets() in node_segment(), and they are not
+     read from (sendbuf) */
+  void alltoallv_on_node(Write<I8> sendbuf, HostRead<LO> sdispls,
+      Write<I8> recvbuf, HostRead<LO> rdispls, Int width,
+      std::vector<MPI_Request>* requests, bool packed = false) const;
+  /* where in node_segment() alltoallv_on_node() puts each message,
+     -1 for those to ranks off this node, or nothing if they do
+     not all fit there */
+  std::vector<I64> node_offsets(HostRead<LO> sdispls, Int width) const;
+  /* this rank's segment of the node window, from which the
+     ranks of this node copy the messages for them */
+  I8* node_segment() const;
+  /* whether alltoallv() reaches neighbors on this node through
+     the node window of the Library. collective the first time */
+  bool has_node_exchange() const;
+#endif
+  /* reports to the profiler, if it is enabled, one alltoallv()
+     with these send displacements and (entry_bytes) per entry.
+     the exchanges above already call this themselves */
+  void add_profile(HostRead<LO> sdispls, Int entry_bytes) const;
   void barrier() const;
+
+ private:
+  template <typename T>
+  Future<T> start_alltoallv(Read<T> sendbuf, Read<LO> sdispls,
+      Read<LO> rdispls, Int width, bool on_node) const;
+#ifdef OMEGA_H_USE_MPI
+  NodeExchange const* node_exchange() const;
+#endif
 };
 
+#ifdef OMEGA_H_USE_MPI
+/* an MPI-3 shared memory window over the ranks of (comm) on each
+   node with (bytes) for every rank, through which Comm exchanges
+   messages between neighbors on the same node with one copy on each
+   side instead of going through the MPI stack.
+   returns null if MPI is older than 3.0 or (bytes) is too small */
+std::shared_ptr<NodeWindow> make_node_window(
+    CommPtr comm, std::size_t bytes);
+#endif
+
+#ifndef OMEGA_H_USE_MPI
+/* runs (f) on (nranks) threads of this process and returns once
+   they have all returned. each thread gets its own rank of one Comm
+   whose messages are copied through shared memory, so partitioned
+   algorithms can use all cores of a machine without MPI.
+   the threads share (library), which must not be timing
+   (--osh-time) nor logging memory (--osh-memory), and Kokkos builds
+   are limited to one rank. with OpenMP each rank runs loops on its
+   own team of omp_get_max_threads() / (nranks) threads */
+void run_thread_ranks(
+    Library* library, I32 nranks, std::function<void(CommPtr)> const& f);
+#endif
+
 #ifdef OMEGA_H_USE_MPI
 
 #ifdef OMPI_MPI_H
@@ -138,6 +230,8 @@ inline MPI_Op mpi_op(Omega_h_Op op) {
   extern template Read<T> Comm::allgather(T x) const;                          \
   extern template Read<T> Comm::alltoall(Read<T> x) const;                     \
   extern template Read<T> Comm::alltoallv(                                     \
+      Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls, Int width) const;   \
+  extern template Future<T> Comm::ialltoallv(                                  \
       Read<T> sendbuf, Read<LO> sdispls, Read<LO> rdispls, Int width) const;
 OMEGA_H_EXPL_INST_DECL(I8)
 OMEGA_H_EXPL_INST_DECL(I32)
@@ -8,6 +8,7 @@
 #include "Omega_h_compare.hpp"
 #include "Omega_h_graph.hpp"
 #include "Omega_h_host_few.hpp"
+#include "Omega_h_lazy.hpp"
 #include "Omega_h_map.hpp"
 #include "Omega_h_r3d.hpp"
 #include "Omega_h_transfer.hpp"
@@ -681,7 +682,8 @@ struct AllBounded : public AndFunctor {
 };
 
 static bool all_bounded(CommPtr comm, Reals a, Real b) {
-  return bool(get_min(comm, each_leq_to(fabs_each(a), b)));
+  return bool(
+      lazy::get_min(comm, lazy::each_leq_to(lazy::fabs_each(a), b)));
 }
 
 static Reals diffuse_densities(Mesh* mesh, Graph g, Reals densities,
@@ -11,10 +11,12 @@
 
 #include "Omega_h_cmdline.hpp"
 #include "Omega_h_library.hpp"
+#include "Omega_h_pool.hpp"
 
 namespace Omega_h {
 
 bool should_log_memory = false;
+bool should_hash_dedup = false;
 char* max_memory_stacktrace = nullptr;
 
 static Library* the_library = nullptr;
@@ -133,22 +135,50 @@ void Library::initialize(char const* head_desc, int* argc, char*** argv
       "--osh-memory", "print amount and stacktrace of max memory use");
   cmdline.add_flag(
       "--osh-time", "print amount of time spend in certain functions");
+  auto& time_json_flag = cmdline.add_flag(
+      "--osh-time-json", "write the --osh-time call tree to a JSON file");
+  time_json_flag.add_arg<std::string>("path");
   cmdline.add_flag("--osh-signal", "catch signals and print a stacktrace");
+  cmdline.add_flag("--osh-pool", "reuse array memory through a caching pool");
+  cmdline.add_flag("--osh-hash-dedup",
+      "derive edges and faces with a hash table instead of sorting");
   cmdline.add_flag("--osh-silent", "suppress all output");
   auto& self_send_flag =
       cmdline.add_flag("--osh-self-send", "control self send threshold");
   self_send_flag.add_arg<int>("value");
+  auto& node_exchange_flag = cmdline.add_flag("--osh-node-exchange",
+      "exchange on-node messages through this many bytes per rank of "
+      "shared memory");
+  node_exchange_flag.add_arg<int>("bytes");
   if (argc && argv) {
     OMEGA_H_CHECK(cmdline.parse(world_, argc, *argv));
   }
   Omega_h::should_log_memory = cmdline.parsed("--osh-memory");
+  Omega_h::should_hash_dedup = cmdline.parsed("--osh-hash-dedup");
   should_time_ = cmdline.parsed("--osh-time");
+  if (cmdline.parsed("--osh-time-json")) {
+    time_json_path_ = cmdline.get<std::string>("--osh-time-json", "path");
+  }
+  if (should_time_ || !time_json_path_.empty()) profile::enable();
   bool should_protect = cmdline.parsed("--osh-signal");
   self_send_threshold_ = 1000 * 1000;
   if (cmdline.parsed("--osh-self-send")) {
     self_send_threshold_ = cmdline.get<int>("--osh-self-send", "value");
   }
   silent_ = cmdline.parsed("--osh-silent");
+#ifdef OMEGA_H_USE_MPI
+  /* off by default, its exchanges add barriers between the ranks
+     of each node, which only pay off for many small messages */
+  std::size_t node_exchange_bytes = 0;
+  if (cmdline.parsed("--osh-node-exchange")) {
+    node_exchange_bytes =
+        std::size_t(cmdline.get<int>("--osh-node-exchange", "bytes"));
+  }
+  node_window_ = make_node_window(world_, node_exchange_bytes);
+#endif
+#ifndef OMEGA_H_USE_KOKKOSCORE
+  if (cmdline.parsed("--osh-pool")) pool_ = PoolPtr(new Pool());
+#endif
 #ifdef OMEGA_H_USE_KOKKOSCORE
   if (!Kokkos::is_initialized()) {
     OMEGA_H_CHECK(argc != nullptr);
@@ -166,9 +196,11 @@ void Library::initialize(char const* head_desc, int* argc, char*** argv
 
 Library::Library(Library const& other)
     : world_(other.world_),
-      self_(other.self_)
+      self_(other.self_),
+      pool_(other.pool_)
 #ifdef OMEGA_H_USE_MPI
       ,
+      node_window_(other.node_window_),
       we_called_mpi_init(other.we_called_mpi_init)
 #endif
 #ifdef OMEGA_H_USE_KOKKOSCORE
@@ -185,6 +217,7 @@ Library::~Library() {
     we_called_kokkos_init = false;
   }
 #endif
+  profile::finalize(world_, should_time_ && !silent_, time_json_path_);
   if (Omega_h::should_log_memory) {
     auto mem_used = get_max_bytes();
     auto max_mem_used =
@@ -194,15 +227,28 @@ Library::~Library() {
     max_mem_rank = world_->allreduce(max_mem_rank, OMEGA_H_MIN);
     if (world_->rank() == max_mem_rank) {
       std::cout << "maximum Omega_h memory usage: " << mem_used << '\n';
+      if (pool_) {
+        auto stats = pool_->stats();
+        std::cout << "Omega_h pool: " << stats.nreused << " of "
+                  << stats.nallocs << " allocations reused cached memory, "
+                  << "maximum bytes in use " << stats.max_used_bytes
+                  << ", maximum bytes cached " << stats.max_cached_bytes
+                  << '\n';
+      }
       if (Omega_h::max_memory_stacktrace) {
         std::cout << Omega_h::max_memory_stacktrace;
       }
     }
   }
+  if (pool_) {
+    pool_->release();
+    pool_ = PoolPtr();
+  }
   // need to destroy all Comm objects prior to MPI_Finalize()
   world_ = CommPtr();
   self_ = CommPtr();
 #ifdef OMEGA_H_USE_MPI
+  node_window_ = std::shared_ptr<NodeWindow>();
   if (we_called_mpi_init) {
     OMEGA_H_CHECK(MPI_SUCCESS == MPI_Finalize());
     we_called_mpi_init = false;
@@ -227,4 +273,14 @@ CommPtr Library::self() {
 
 LO Library::self_send_threshold() const { return self_send_threshold_; }
 
+#ifdef OMEGA_H_USE_MPI
+NodeWindow* Library::node_window() const { return node_window_.get(); }
+#endif
+
+PoolPtr Library::pool() const { return pool_; }
+
+PoolPtr get_array_pool() {
+  return the_library ? the_library->pool() : PoolPtr();
+}
+
 }  // end namespace Omega_h
@@ -5,6 +5,7 @@
 
 namespace Omega_h {
 extern bool should_log_memory;
+extern bool should_hash_dedup;
 extern char* max_memory_stacktrace;
 void print_stacktrace(std::ostream& out, int max_frames);
 }  // namespace Omega_h
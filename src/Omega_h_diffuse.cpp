@@ -0,0 +1,133 @@
+#include "Omega_h_diffuse.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Omega_h_array_ops.hpp"
+
+namespace Omega_h {
+
+namespace diffusion {
+
+namespace {
+
+/* the flow of weight from this rank to each of its neighbors
+   (negative for inflow) that brings all ranks close to (avg_weight).
+   each iteration every rank gives each neighbor
+   a fraction of their difference in weight, the fraction being
+   small enough for the iteration to converge */
+std::vector<Real> get_flows(
+    CommPtr comm, Real weight, Real avg_weight, Real max_deviation) {
+  auto nbrs = HostRead<I32>(comm->destinations());
+  auto nnbrs = nbrs.size();
+  auto nbr_degrees = HostRead<I32>(comm->allgather(I32(nnbrs)));
+  std::vector<Real> alphas(static_cast<std::size_t>(nnbrs));
+  for (LO i = 0; i < nnbrs; ++i) {
+    alphas[std::size_t(i)] = 1.0 / (max2(nnbrs, nbr_degrees[i]) + 1);
+  }
+  std::vector<Real> flows(std::size_t(nnbrs), 0.0);
+  Int const max_iters = 1000;
+  for (Int iter = 0; iter < max_iters; ++iter) {
+    auto deviation = std::abs(weight - avg_weight);
+    if (comm->allreduce(deviation, OMEGA_H_MAX) <= max_deviation) break;
+    auto nbr_weights = HostRead<Real>(comm->allgather(weight));
+    auto new_weight = weight;
+    for (LO i = 0; i < nnbrs; ++i) {
+      auto flow = alphas[std::size_t(i)] * (weight - nbr_weights[i]);
+      flows[std::size_t(i)] += flow;
+      new_weight -= flow;
+    }
+    weight = new_weight;
+  }
+  return flows;
+}
+
+}  // end anonymous namespace
+
+Read<I32> rebalance(multilevel::DistGraph graph, Real tolerance) {
+  auto comm = graph.comm;
+  auto rank = comm->rank();
+  auto n = graph.weights.size();
+  auto weights = HostRead<Real>(graph.weights);
+  auto a2ab = HostRead<LO>(graph.a2ab);
+  auto ab2ranks = HostRead<I32>(graph.ab2b.ranks);
+  auto ab2idxs = HostRead<LO>(graph.ab2b.idxs);
+  std::vector<I32> dests(std::size_t(n), rank);
+  Real weight = 0.0;
+  for (LO a = 0; a < n; ++a) weight += weights[a];
+  auto total_weight = get_sum(comm, graph.weights);
+  auto avg_weight = total_weight / comm->size();
+  auto max_weight = comm->allreduce(weight, OMEGA_H_MAX);
+  if (max_weight <= tolerance * avg_weight) {
+    return Read<I32>(n, rank);
+  }
+  std::vector<I32> nbrs;
+  for (LO ab = 0; ab < ab2ranks.size(); ++ab) {
+    if (ab2ranks[ab] != rank) nbrs.push_back(ab2ranks[ab]);
+  }
+  std::sort(nbrs.begin(), nbrs.end());
+  nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+  HostWrite<I32> h_nbrs(LO(nbrs.size()));
+  for (LO i = 0; i < h_nbrs.size(); ++i) h_nbrs[i] = nbrs[std::size_t(i)];
+  auto nbr_comm = comm->graph_adjacent(h_nbrs.write(), h_nbrs.write());
+  /* converge further than asked, the nodes sent
+     only approximate the flows */
+  auto max_deviation = (tolerance - 1.0) * avg_weight / 2.0;
+  auto flows = get_flows(nbr_comm, weight, avg_weight, max_deviation);
+  /* a rank can not send more than it has, which diffusion
+     may ask of a light rank that lies between heavy and
+     light regions */
+  Real outflow = 0.0;
+  for (auto flow : flows) outflow += max2(flow, 0.0);
+  if (outflow > weight) {
+    for (auto& flow : flows) flow *= weight / outflow;
+  }
+  /* the fronts towards all neighbors grow one layer at a time
+     together, so that one neighbor does not take the nodes
+     bordering another */
+  auto nnbrs = nbrs.size();
+  std::vector<std::vector<LO>> layers(nnbrs);
+  std::vector<Real> sent(nnbrs, 0.0);
+  for (LO a = 0; a < n; ++a) {
+    for (auto ab = a2ab[a]; ab < a2ab[a + 1]; ++ab) {
+      if (ab2ranks[ab] == rank) continue;
+      auto i = std::size_t(
+          std::lower_bound(nbrs.begin(), nbrs.end(), ab2ranks[ab]) -
+          nbrs.begin());
+      if (flows[i] <= 0.0) continue;
+      if (layers[i].empty() || layers[i].back() != a) layers[i].push_back(a);
+    }
+  }
+  std::vector<LO> next_layer;
+  bool is_growing = true;
+  while (is_growing) {
+    is_growing = false;
+    for (std::size_t i = 0; i < nnbrs; ++i) {
+      auto& layer = layers[i];
+      next_layer.clear();
+      for (auto a : layer) {
+        if (dests[std::size_t(a)] != rank) continue;
+        /* stop short rather than overshoot by more than half a node */
+        if (sent[i] + weights[a] / 2.0 > flows[i]) {
+          next_layer.clear();
+          break;
+        }
+        dests[std::size_t(a)] = nbrs[i];
+        sent[i] += weights[a];
+        for (auto ab = a2ab[a]; ab < a2ab[a + 1]; ++ab) {
+          if (ab2ranks[ab] == rank) next_layer.push_back(ab2idxs[ab]);
+        }
+      }
+      layer.swap(next_layer);
+      if (!layer.empty()) is_growing = true;
+    }
+  }
+  HostWrite<I32> h_dests(n);
+  for (LO a = 0; a < n; ++a) h_dests[a] = dests[std::size_t(a)];
+  return h_dests.write();
+}
+
+}  // namespace diffusion
+
+}  // end namespace Omega_h
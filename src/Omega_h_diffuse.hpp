@@ -0,0 +1,28 @@
+#ifndef OMEGA_H_DIFFUSE_HPP
+#define OMEGA_H_DIFFUSE_HPP
+
+#include "Omega_h_multilevel.hpp"
+
+namespace Omega_h {
+
+namespace diffusion {
+
+/* chooses a destination rank for each local node of (graph) so that
+   the weight moved between each pair of neighboring ranks is the
+   net flow of a first-order diffusion of the rank weights towards
+   their average.
+   a rank sends the nodes nearest to the receiving rank first,
+   growing inwards from their shared boundary one layer at a time,
+   so the moved weight is proportional to the imbalance and the
+   parts stay in one piece.
+   if no rank weighs more than (tolerance) times the average,
+   every node stays where it is.
+   weight only flows along graph edges between ranks, so a rank
+   without any can not be balanced this way */
+Read<I32> rebalance(multilevel::DistGraph graph, Real tolerance);
+
+}  // namespace diffusion
+
+}  // end namespace Omega_h
+
+#endif
@@ -1,5 +1,8 @@
 #include "Omega_h_dist.hpp"
 
+#include <limits>
+#include <utility>
+
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
@@ -8,7 +11,110 @@
 
 namespace Omega_h {
 
-Dist::Dist() {}
+template <typename T>
+struct BundleSlot;
+
+template <>
+struct BundleSlot<I8> {
+  static constexpr Omega_h_Type type = OMEGA_H_I8;
+  template <typename E>
+  static auto get(E& e) -> decltype((e.i8)) {
+    return e.i8;
+  }
+};
+
+template <>
+struct BundleSlot<I32> {
+  static constexpr Omega_h_Type type = OMEGA_H_I32;
+  template <typename E>
+  static auto get(E& e) -> decltype((e.i32)) {
+    return e.i32;
+  }
+};
+
+template <>
+struct BundleSlot<I64> {
+  static constexpr Omega_h_Type type = OMEGA_H_I64;
+  template <typename E>
+  static auto get(E& e) -> decltype((e.i64)) {
+    return e.i64;
+  }
+};
+
+template <>
+struct BundleSlot<Real> {
+  static constexpr Omega_h_Type type = OMEGA_H_F64;
+  template <typename E>
+  static auto get(E& e) -> decltype((e.f64)) {
+    return e.f64;
+  }
+};
+
+template <typename T>
+Int DistBundle::add(Read<T> data, Int width) {
+  Entry entry;
+  entry.type = BundleSlot<T>::type;
+  entry.width = width;
+  BundleSlot<T>::get(entry) = data;
+  entries_.push_back(entry);
+  return Int(entries_.size()) - 1;
+}
+
+template <typename T>
+Read<T> DistBundle::get(Int i) const {
+  auto& entry = entries_[std::size_t(i)];
+  OMEGA_H_CHECK(entry.type == BundleSlot<T>::type);
+  return BundleSlot<T>::get(entry);
+}
+
+Int DistBundle::size() const { return Int(entries_.size()); }
+
+static Int type_size(Omega_h_Type type) {
+  switch (type) {
+    case OMEGA_H_I8:
+      return Int(sizeof(I8));
+    case OMEGA_H_I32:
+      return Int(sizeof(I32));
+    case OMEGA_H_I64:
+      return Int(sizeof(I64));
+    case OMEGA_H_F64:
+      return Int(sizeof(Real));
+  }
+  OMEGA_H_NORETURN(0);
+}
+
+/* copies (width) bytes per packet between a typed array with
+   (stride) bytes per packet and the packed byte array */
+static void pack_bytes(I8 const* from, Int from_stride, Int from_offset,
+    I8* to, Int to_stride, Int to_offset, Int width, LO n) {
+  auto f = OMEGA_H_LAMBDA(LO i) {
+    auto src = from + std::size_t(i) * std::size_t(from_stride) + from_offset;
+    auto dst = to + std::size_t(i) * std::size_t(to_stride) + to_offset;
+    for (Int j = 0; j < width; ++j) dst[j] = src[j];
+  };
+  parallel_for(n, f, "pack_bytes");
+}
+
+template <typename T>
+static void pack_entry(Read<T> data, Int width, Write<I8> packed,
+    Int packet_bytes, Int offset, LO n) {
+  OMEGA_H_CHECK(data.size() == n * width);
+  auto nbytes = width * Int(sizeof(T));
+  pack_bytes(reinterpret_cast<I8 const*>(data.data()), nbytes, 0,
+      packed.data(), packet_bytes, offset, nbytes, n);
+}
+
+template <typename T>
+static Read<T> unpack_entry(
+    Read<I8> packed, Int packet_bytes, Int offset, Int width, LO n) {
+  auto nbytes = width * Int(sizeof(T));
+  Write<T> out(n * width);
+  pack_bytes(packed.data(), packet_bytes, offset,
+      reinterpret_cast<I8*>(out.data()), nbytes, 0, nbytes, n);
+  return out;
+}
+
+Dist::Dist() : max_packets_(std::make_shared<GO>(-1)) {}
 
 Dist::Dist(Dist const& other) { copy(other); }
 
@@ -17,7 +123,8 @@ Dist& Dist::operator=(Dist const& other) {
   return *this;
 }
 
-Dist::Dist(CommPtr comm_in, Remotes fitems2rroots, LO nrroots) {
+Dist::Dist(CommPtr comm_in, Remotes fitems2rroots, LO nrroots)
+    : max_packets_(std::make_shared<GO>(-1)) {
   set_parent_comm(comm_in);
   set_dest_ranks(fitems2rroots.ranks);
   set_dest_idxs(fitems2rroots.idxs, nrroots);
@@ -25,10 +132,12 @@ Dist::Dist(CommPtr comm_in, Remotes fitems2rroots, LO nrroots) {
 
 void Dist::set_parent_comm(CommPtr parent_comm_in) {
   parent_comm_ = parent_comm_in;
+  max_packets_ = std::make_shared<GO>(-1);
 }
 
 void Dist::set_dest_ranks(Read<I32> items2ranks_in) {
   begin_code("Dist::set_dest_ranks");
+  max_packets_ = std::make_shared<GO>(-1);
   constexpr bool use_small_neighborhood_algorithm = true;
   if (use_small_neighborhood_algorithm) {
     Read<I32> msgs2ranks1;
@@ -76,6 +185,7 @@ void Dist::set_dest_ranks(Read<I32> items2ranks_in) {
 
 void Dist::set_dest_idxs(LOs fitems2rroots, LO nrroots) {
   begin_code("Dist::set_dest_idxs");
+  max_packets_ = std::make_shared<GO>(-1);
   auto rcontent2rroots = exch(fitems2rroots, 1);
   auto rroots2rcontent = invert_map_by_atomics(rcontent2rroots, nrroots);
   roots2items_[R] = rroots2rcontent.a2ab;
@@ -85,6 +195,7 @@ void Dist::set_dest_idxs(LOs fitems2rroots, LO nrroots) {
 
 void Dist::set_dest_globals(GOs fitems2ritem_globals) {
   begin_code("Dist::set_dest_globals");
+  max_packets_ = std::make_shared<GO>(-1);
   auto rcontent2ritem_globals = exch(fitems2ritem_globals, 1);
   items2content_[R] = sort_by_keys(rcontent2ritem_globals);
   roots2items_[R] = LOs();
@@ -93,6 +204,7 @@ void Dist::set_dest_globals(GOs fitems2ritem_globals) {
 
 void Dist::set_roots2items(LOs froots2fitems) {
   roots2items_[F] = froots2fitems;
+  max_packets_ = std::make_shared<GO>(-1);
 }
 
 Dist Dist::invert() const {
@@ -109,19 +221,140 @@ Dist Dist::invert() const {
 
 template <typename T>
 Read<T> Dist::exch(Read<T> data, Int width) const {
-//begin_code("Dist::exch");
+  auto future = exch_begin(data, width);
+  return exch_end(future);
+}
+
+template <typename T>
+Future<T> Dist::exch_begin(Read<T> data, Int width) const {
   if (roots2items_[F].exists()) {
     data = expand(data, roots2items_[F], width);
   }
   if (items2content_[F].exists()) {
     data = permute(data, items2content_[F], width);
   }
-  data = comm_[F]->alltoallv(data, msgs2content_[F], msgs2content_[R], width);
+  auto future =
+      comm_[F]->ialltoallv(data, msgs2content_[F], msgs2content_[R], width);
   if (items2content_[R].exists()) {
-    data = unmap(items2content_[R], data, width);
+    auto ritems2rcontent = items2content_[R];
+    future.add_callback([=](Read<T> rcontent_data) {
+      return unmap(ritems2rcontent, rcontent_data, width);
+    });
   }
-//end_code();
-  return data;
+  return future;
+}
+
+template <typename T>
+Read<T> Dist::exch_end(Future<T>& future) const {
+  return future.get();
+}
+
+DistBundle Dist::exch(DistBundle const& data) const {
+  begin_code("Dist::exch(DistBundle)");
+  auto nsrcs = this->nsrcs();
+  auto nrecvd = msgs2content_[R].last();
+  /* the packed array has (packet_bytes) entries per packet where each
+     array alone has (width), so its int counts overflow that many times
+     sooner. entries are grouped so that each packed exchange fits, and
+     an entry that fits with no other goes alone in its own type.
+     all ranks must make the same groups, from a maximum that is
+     only reduced again after the pattern changes */
+  auto& max_packets = *max_packets_;
+  if (max_packets < 0) {
+    max_packets = parent_comm_->allreduce(
+        GO(max2(max2(nsrcs, nitems()), nrecvd)), OMEGA_H_MAX);
+  }
+  auto const max_ints = GO(std::numeric_limits<int>::max());
+  auto entry_bytes = [](DistBundle::Entry const& entry) {
+    return entry.width * type_size(entry.type);
+  };
+  DistBundle out;
+  auto& entries = data.entries_;
+  std::size_t first = 0;
+  while (first < entries.size()) {
+    Int packet_bytes = entry_bytes(entries[first]);
+    auto last = first + 1;
+    while (last < entries.size() &&
+           GO(packet_bytes + entry_bytes(entries[last])) * max_packets <=
+               max_ints) {
+      packet_bytes += entry_bytes(entries[last]);
+      ++last;
+    }
+    if (last == first + 1) {
+      auto& entry = entries[first];
+      switch (entry.type) {
+        case OMEGA_H_I8:
+          out.add(exch(entry.i8, entry.width), entry.width);
+          break;
+        case OMEGA_H_I32:
+          out.add(exch(entry.i32, entry.width), entry.width);
+          break;
+        case OMEGA_H_I64:
+          out.add(exch(entry.i64, entry.width), entry.width);
+          break;
+        case OMEGA_H_F64:
+          out.add(exch(entry.f64, entry.width), entry.width);
+          break;
+      }
+      first = last;
+      continue;
+    }
+    Write<I8> packed(nsrcs * packet_bytes);
+    Int offset = 0;
+    for (auto i = first; i < last; ++i) {
+      auto& entry = entries[i];
+      switch (entry.type) {
+        case OMEGA_H_I8:
+          pack_entry(
+              entry.i8, entry.width, packed, packet_bytes, offset, nsrcs);
+          break;
+        case OMEGA_H_I32:
+          pack_entry(
+              entry.i32, entry.width, packed, packet_bytes, offset, nsrcs);
+          break;
+        case OMEGA_H_I64:
+          pack_entry(
+              entry.i64, entry.width, packed, packet_bytes, offset, nsrcs);
+          break;
+        case OMEGA_H_F64:
+          pack_entry(
+              entry.f64, entry.width, packed, packet_bytes, offset, nsrcs);
+          break;
+      }
+      offset += entry_bytes(entry);
+    }
+    auto received = exch(Read<I8>(packed), packet_bytes);
+    offset = 0;
+    for (auto i = first; i < last; ++i) {
+      auto width = entries[i].width;
+      switch (entries[i].type) {
+        case OMEGA_H_I8:
+          out.add(
+              unpack_entry<I8>(received, packet_bytes, offset, width, nrecvd),
+              width);
+          break;
+        case OMEGA_H_I32:
+          out.add(
+              unpack_entry<I32>(received, packet_bytes, offset, width, nrecvd),
+              width);
+          break;
+        case OMEGA_H_I64:
+          out.add(
+              unpack_entry<I64>(received, packet_bytes, offset, width, nrecvd),
+              width);
+          break;
+        case OMEGA_H_F64:
+          out.add(
+              unpack_entry<Real>(received, packet_bytes, offset, width, nrecvd),
+              width);
+          break;
+      }
+      offset += entry_bytes(entries[i]);
+    }
+    first = last;
+  }
+  end_code();
+  return out;
 }
 
 template <typename T>
@@ -182,13 +415,16 @@ void Dist::change_comm(CommPtr new_comm) {
   comm_[R] = comm_[F]->graph_inverse();
   // replace parent_comm_
   parent_comm_ = new_comm;
+  max_packets_ = std::make_shared<GO>(-1);
   // thats it! since all rank information is queried from graph comms
 }
 
 Remotes Dist::exch(Remotes data, Int width) const {
-  auto ranks = exch(data.ranks, width);
-  auto idxs = exch(data.idxs, width);
-  return Remotes(ranks, idxs);
+  DistBundle bundle;
+  bundle.add(data.ranks, width);
+  bundle.add(data.idxs, width);
+  bundle = exch(bundle);
+  return Remotes(bundle.get<I32>(0), bundle.get<LO>(1));
 }
 
 void Dist::copy(Dist const& other) {
@@ -199,10 +435,242 @@ void Dist::copy(Dist const& other) {
     msgs2content_[i] = other.msgs2content_[i];
     comm_[i] = other.comm_[i];
   }
+  max_packets_ = other.max_packets_;
+}
+
+/* copies one packet of (packet_bytes) into each of the (n)
+   slots of (to) from slot to2from[i] of (from),
+   or from slot i if (to2from) is empty */
+static void gather_packets(
+    I8 const* from, LOs to2from, I8* to, Int packet_bytes, LO n) {
+  if (!to2from.exists()) {
+    pack_bytes(from, packet_bytes, 0, to, packet_bytes, 0, packet_bytes, n);
+    return;
+  }
+  auto f = OMEGA_H_LAMBDA(LO i) {
+    auto src = from + std::size_t(to2from[i]) * std::size_t(packet_bytes);
+    auto dst = to + std::size_t(i) * std::size_t(packet_bytes);
+    for (Int j = 0; j < packet_bytes; ++j) dst[j] = src[j];
+  };
+  parallel_for(n, f, "gather_packets");
+}
+
+#ifdef OMEGA_H_USE_MPI
+/* gather_packets() into (to), except that the packets with an offset
+   in (to2segment) go straight to that offset of (segment), the part
+   of the node window their receivers copy them out of */
+static void gather_packets_on_node(I8 const* from, LOs to2from, I8* to,
+    Read<I64> to2segment, I8* segment, Int packet_bytes, LO n) {
+  auto is_identity = !to2from.exists();
+  auto f = OMEGA_H_LAMBDA(LO i) {
+    auto j = is_identity ? i : to2from[i];
+    auto src = from + std::size_t(j) * std::size_t(packet_bytes);
+    auto dst = (to2segment[i] < 0)
+                   ? to + std::size_t(i) * std::size_t(packet_bytes)
+                   : segment + to2segment[i];
+    for (Int k = 0; k < packet_bytes; ++k) dst[k] = src[k];
+  };
+  parallel_for(n, f, "gather_packets_on_node");
+}
+#endif
+
+struct DistPlan::State {
+  Dist dist;
+  Int packet_bytes;
+  LO nroots;
+  LO nritems;
+  LOs content2roots;
+  LOs ritems2rcontent;
+  HostRead<LO> host_sdispls;
+  HostRead<LO> host_rdispls;
+  Write<I8> sendbuf;
+  Write<I8> recvbuf;
+  bool in_flight;
+#ifdef OMEGA_H_USE_MPI
+  std::vector<MPI_Request> requests;
+  /* set if blocking exchanges reach the neighbors on this node through
+     Comm::alltoallv_on_node(), (off_node_requests) then are the
+     persistent requests for the other neighbors */
+  bool on_node;
+  std::vector<MPI_Request> off_node_requests;
+  /* if all messages on this node fit in the node window, the offset
+     at which each outgoing packet to that node is packed straight into
+     (node_segment) by blocking exchanges, or -1 for the others */
+  Read<I64> content2segment;
+  I8* node_segment;
+  ~State() {
+    for (auto& request : requests) {
+      OMEGA_H_CHECK(MPI_SUCCESS == MPI_Request_free(&request));
+    }
+    for (auto& request : off_node_requests) {
+      OMEGA_H_CHECK(MPI_SUCCESS == MPI_Request_free(&request));
+    }
+  }
+#endif
+};
+
+DistPlan::DistPlan(Dist const& dist, Int packet_bytes)
+    : state_(std::make_shared<State>()) {
+  begin_code("DistPlan::DistPlan");
+  auto& state = *state_;
+  state.dist = dist;
+  state.packet_bytes = packet_bytes;
+  state.in_flight = false;
+  state.nroots = dist.nsrcs();
+  /* compound expand() and permute() into one map from
+     each outgoing packet to the root it is copied from */
+  auto roots2items = dist.roots2items_[Dist::F];
+  auto items2content = dist.items2content_[Dist::F];
+  if (roots2items.exists()) state.content2roots = invert_fan(roots2items);
+  if (items2content.exists()) {
+    auto items2roots = state.content2roots.exists()
+                           ? state.content2roots
+                           : LOs(items2content.size(), 0, 1);
+    state.content2roots = permute(items2roots, items2content, 1);
+  }
+  state.ritems2rcontent = dist.items2content_[Dist::R];
+  auto ncontent = dist.msgs2content_[Dist::F].last();
+  auto nrcontent = dist.msgs2content_[Dist::R].last();
+  state.nritems = state.ritems2rcontent.exists() ? state.ritems2rcontent.size()
+                                                 : nrcontent;
+  state.sendbuf = Write<I8>(ncontent * packet_bytes);
+#ifdef OMEGA_H_USE_MPI
+#if !defined(OMEGA_H_USE_CUDA) || defined(OMEGA_H_USE_CUDA_AWARE_MPI)
+  state.recvbuf = Write<I8>(nrcontent * packet_bytes);
+  state.host_sdispls = HostRead<LO>(dist.msgs2content_[Dist::F]);
+  state.host_rdispls = HostRead<LO>(dist.msgs2content_[Dist::R]);
+  auto comm = dist.comm_[Dist::F];
+  state.requests = comm->alltoallv_init(state.sendbuf,
+      dist.msgs2content_[Dist::F], state.recvbuf, dist.msgs2content_[Dist::R],
+      packet_bytes);
+  state.on_node = comm->has_node_exchange();
+  state.node_segment = nullptr;
+  if (state.on_node) {
+    state.off_node_requests = comm->alltoallv_init(state.sendbuf,
+        dist.msgs2content_[Dist::F], state.recvbuf,
+        dist.msgs2content_[Dist::R], packet_bytes, true);
+    auto offsets = comm->node_offsets(state.host_sdispls, packet_bytes);
+    if (!offsets.empty()) {
+      auto& sdispls = state.host_sdispls;
+      HostWrite<I64> content2segment(ncontent);
+      for (LO msg = 0; msg + 1 < sdispls.size(); ++msg) {
+        auto offset = offsets[std::size_t(msg)];
+        for (auto c = sdispls[msg]; c < sdispls[msg + 1]; ++c) {
+          content2segment[c] =
+              (offset < 0) ? -1
+                           : offset + I64(c - sdispls[msg]) * packet_bytes;
+        }
+      }
+      state.content2segment = content2segment.write();
+      state.node_segment = comm->node_segment();
+    }
+  }
+#else
+  state.on_node = false;
+  state.node_segment = nullptr;
+#endif
+#else
+  state.recvbuf = state.sendbuf;
+#endif
+  end_code();
+}
+
+Int DistPlan::packet_bytes() const { return state_->packet_bytes; }
+
+template <typename T>
+Read<T> DistPlan::exch(Read<T> data, Int width) const {
+  auto future = start(data, width, true);
+  return future.get();
+}
+
+template <typename T>
+Future<T> DistPlan::exch_begin(Read<T> data, Int width) const {
+  return start(data, width, false);
+}
+
+template <typename T>
+Future<T> DistPlan::start(Read<T> data, Int width, bool on_node) const {
+  auto state = state_;
+  auto packet_bytes = state->packet_bytes;
+  OMEGA_H_CHECK(width * Int(sizeof(T)) == packet_bytes);
+  OMEGA_H_CHECK(data.size() == state->nroots * width);
+#if defined(OMEGA_H_USE_MPI) && defined(OMEGA_H_USE_CUDA) &&                   \
+    !defined(OMEGA_H_USE_CUDA_AWARE_MPI)
+  /* persistent requests would need host buffers,
+     so the plan only forwards to its Dist */
+  (void)on_node;
+  return state->dist.exch_begin(data, width);
+#else
+  if (state->in_flight) return state->dist.exch_begin(data, width);
+#ifndef OMEGA_H_USE_MPI
+  /* ranks that are threads (see run_thread_ranks) have no
+     requests to reuse, they exchange through the Dist */
+  if (state->dist.parent_comm()->size() > 1) {
+    return state->dist.exch_begin(data, width);
+  }
+#endif
+  auto ncontent = divide_no_remainder(state->sendbuf.size(), packet_bytes);
+#ifdef OMEGA_H_USE_MPI
+  /* only blocking exchanges may wait in the barriers of the node window */
+  on_node = on_node && state->on_node;
+  auto packed = on_node && state->node_segment != nullptr;
+  if (packed) {
+    gather_packets_on_node(reinterpret_cast<I8 const*>(data.data()),
+        state->content2roots, state->sendbuf.data(), state->content2segment,
+        state->node_segment, packet_bytes, ncontent);
+  } else {
+    gather_packets(reinterpret_cast<I8 const*>(data.data()),
+        state->content2roots, state->sendbuf.data(), packet_bytes, ncontent);
+  }
+#else
+  gather_packets(reinterpret_cast<I8 const*>(data.data()),
+      state->content2roots, state->sendbuf.data(), packet_bytes, ncontent);
+#endif
+  /* the buffers are free again once the Future lets go of its
+     finisher, after it was either called by get() or the Future
+     was destroyed, both of which first wait for the requests */
+  struct Landing {
+    std::shared_ptr<State> state;
+    ~Landing() { state->in_flight = false; }
+  };
+  auto landing = std::make_shared<Landing>();
+  landing->state = state;
+  state->in_flight = true;
+  auto finish = [landing, width]() {
+    auto& plan = *(landing->state);
+    Write<T> out(plan.nritems * width);
+    gather_packets(plan.recvbuf.data(), plan.ritems2rcontent,
+        reinterpret_cast<I8*>(out.data()), plan.packet_bytes, plan.nritems);
+    return Read<T>(out);
+  };
+#ifdef OMEGA_H_USE_MPI
+  auto requests = on_node ? state->off_node_requests : state->requests;
+  if (!requests.empty()) {
+    OMEGA_H_CHECK(MPI_SUCCESS ==
+                  MPI_Startall(int(requests.size()), requests.data()));
+  }
+  auto comm = state->dist.comm_[Dist::F];
+  if (on_node) {
+    comm->alltoallv_on_node(state->sendbuf, state->host_sdispls,
+        state->recvbuf, state->host_rdispls, packet_bytes, &requests, packed);
+  }
+  comm->add_profile(state->host_sdispls, packet_bytes);
+  return Future<T>(std::move(requests), finish);
+#else
+  (void)on_node;
+  return Future<T>(finish());
+#endif
+#endif
 }
 
 #define INST_T(T)                                                              \
+  template Int DistBundle::add(Read<T> data, Int width);                       \
+  template Read<T> DistBundle::get(Int i) const;                               \
   template Read<T> Dist::exch(Read<T> data, Int width) const;                  \
+  template Future<T> Dist::exch_begin(Read<T> data, Int width) const;          \
+  template Read<T> Dist::exch_end(Future<T>& future) const;                    \
+  template Read<T> DistPlan::exch(Read<T> data, Int width) const;              \
+  template Future<T> DistPlan::exch_begin(Read<T> data, Int width) const;      \
   template Read<T> Dist::exch_reduce(Read<T> data, Int width, Omega_h_Op op)   \
       const;
 INST_T(I8)
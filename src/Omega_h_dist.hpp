@@ -1,11 +1,40 @@
 #ifndef OMEGA_H_DIST_HPP
 #define OMEGA_H_DIST_HPP
 
+#include <memory>
+#include <vector>
+
 #include <Omega_h_comm.hpp>
 #include <Omega_h_remotes.hpp>
 
 namespace Omega_h {
 
+/* a set of arrays of possibly different types and widths,
+   all holding one packet per source node.
+   Dist::exch(DistBundle) packs them into one byte array so
+   that they travel in a single collective, which matters
+   when communication is dominated by latency. */
+class DistBundle {
+ public:
+  template <typename T>
+  Int add(Read<T> data, Int width);
+  template <typename T>
+  Read<T> get(Int i) const;
+  Int size() const;
+
+ private:
+  struct Entry {
+    Omega_h_Type type;
+    Int width;
+    Read<I8> i8;
+    Read<I32> i32;
+    Read<I64> i64;
+    Read<Real> f64;
+  };
+  std::vector<Entry> entries_;
+  friend class Dist;
+};
+
 /* Welcome to Dist, the magical parallel machine !
 
    This class implements a communication pattern
@@ -85,6 +114,10 @@ class Dist {
   LOs items2content_[2];
   LOs msgs2content_[2];
   CommPtr comm_[2];
+  /* the most packets any rank sends, expands or receives,
+     reduced by the first exch(DistBundle) and shared by the
+     copies of this Dist until one of them changes the pattern */
+  std::shared_ptr<GO> max_packets_;
 
  public:
   Dist();
@@ -127,6 +160,17 @@ class Dist {
   Read<T> exch(Read<T> data, Int width) const;
   template <typename T>
   Read<T> exch_reduce(Read<T> data, Int width, Omega_h_Op op) const;
+  /* split-phase exch(): exch_begin() sends (data) and returns
+     at once, exch_end() waits for the messages and returns
+     what exch() would have. the caller may compute in between,
+     but must not write into the storage of (data). */
+  template <typename T>
+  Future<T> exch_begin(Read<T> data, Int width) const;
+  template <typename T>
+  Read<T> exch_end(Future<T>& future) const;
+  /* equivalent to calling exch() on each array in the bundle,
+     but with one message per neighbor instead of one per array */
+  DistBundle exch(DistBundle const& data) const;
   CommPtr parent_comm() const;
   CommPtr comm() const;
   LOs msgs2content() const;
@@ -147,10 +191,48 @@ class Dist {
  private:
   void copy(Dist const& other);
   enum { F, R };
+  friend class DistPlan;
 };
 
+/* Dist::exch() set up once for packets of a fixed size
+   and reused, for callers that repeat the same exchange many
+   times (e.g. Mesh::sync_array() in an iterative solver).
+   the forward maps of the Dist are compounded into a single
+   gather, host copies of the message sizes are made once,
+   and the send and receive buffers are allocated once and bound
+   to persistent MPI requests, so each exchange only moves data.
+   blocking exchanges pack the packets for ranks on the same node
+   straight into the node window (see Comm::node_segment()), which
+   those ranks copy them out of, so they are only copied once.
+   if the plan is already in flight (exch_begin() without the
+   matching get()), it falls back to the plain Dist path. */
+class DistPlan {
+ public:
+  DistPlan(Dist const& dist, Int packet_bytes);
+  Int packet_bytes() const;
+  template <typename T>
+  Read<T> exch(Read<T> data, Int width) const;
+  template <typename T>
+  Future<T> exch_begin(Read<T> data, Int width) const;
+
+ private:
+  template <typename T>
+  Future<T> start(Read<T> data, Int width, bool on_node) const;
+  struct State;
+  std::shared_ptr<State> state_;
+};
+
+typedef std::shared_ptr<DistPlan> DistPlanPtr;
+
 #define OMEGA_H_EXPL_INST_DECL(T)                                              \
+  extern template Int DistBundle::add(Read<T> data, Int width);                \
+  extern template Read<T> DistBundle::get(Int i) const;                        \
   extern template Read<T> Dist::exch(Read<T> data, Int width) const;           \
+  extern template Future<T> Dist::exch_begin(Read<T> data, Int width) const;   \
+  extern template Read<T> Dist::exch_end(Future<T>& future) const;             \
+  extern template Read<T> DistPlan::exch(Read<T> data, Int width) const;       \
+  extern template Future<T> DistPlan::exch_begin(Read<T> data, Int width)      \
+      const;                                                                   \
   extern template Read<T> Dist::exch_reduce<T>(                                \
       Read<T> data, Int width, Omega_h_Op op) const;
 OMEGA_H_EXPL_INST_DECL(I8)
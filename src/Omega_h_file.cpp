@@ -1,20 +1,39 @@
 #include "Omega_h_file.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 #include <cerrno>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
+#include <type_traits>
 
 #ifdef OMEGA_H_USE_ZLIB
 #include <zlib.h>
 #endif
+#ifdef OMEGA_H_USE_LZ4
+#include <lz4.h>
+#endif
+#ifdef OMEGA_H_USE_ZSTD
+#include <zstd.h>
+#endif
 
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_inertia.hpp"
 #include "Omega_h_loop.hpp"
+#include "Omega_h_map.hpp"
 #include "Omega_h_mesh.hpp"
+#include "Omega_h_remotes.hpp"
+#include "Omega_h_scan.hpp"
+#include "Omega_h_simplex.hpp"
+#include "Omega_h_sort.hpp"
 
 namespace Omega_h {
 
@@ -129,6 +148,369 @@ OMEGA_H_INLINE void swap_bytes(T* ptr) {
 
 unsigned char const magic[2] = {0xa1, 0x1a};
 
+/* since version 7, uncompressed array contents start at a multiple
+   of this many bytes from the start of the file, so a mapped file
+   can hand out properly aligned pointers */
+constexpr std::streamoff array_alignment = 8;
+
+std::streamoff alignment_padding(std::streamoff pos) {
+  if (pos < 0) return 0;
+  return (array_alignment - (pos % array_alignment)) % array_alignment;
+}
+
+void write_padding(std::ostream& stream) {
+  char const zeros[array_alignment] = {0};
+  stream.write(zeros, alignment_padding(stream.tellp()));
+}
+
+void skip_padding(std::istream& stream) {
+  stream.seekg(alignment_padding(stream.tellg()), std::ios_base::cur);
+}
+
+/* since version 8, compressed arrays are split into blocks of
+   this many uncompressed bytes which are compressed independently */
+constexpr I64 compression_block_bytes = I64(1) << 20;
+
+std::size_t compress_bound(Codec codec, std::size_t nbytes) {
+  switch (codec) {
+#ifdef OMEGA_H_USE_ZLIB
+    case ZLIB_CODEC:
+      return ::compressBound(static_cast<uLong>(nbytes));
+#endif
+#ifdef OMEGA_H_USE_LZ4
+    case LZ4_CODEC:
+      return static_cast<std::size_t>(
+          ::LZ4_compressBound(static_cast<int>(nbytes)));
+#endif
+#ifdef OMEGA_H_USE_ZSTD
+    case ZSTD_CODEC:
+      return ::ZSTD_compressBound(nbytes);
+#endif
+    default:
+      break;
+  }
+  Omega_h_fail("codec %d is not available in this build\n", int(codec));
+}
+
+/* returns the compressed size, or zero on failure.
+   these are called concurrently, so they may not fail directly */
+std::size_t compress_block(Codec codec, char const* src, std::size_t nbytes,
+    char* dst, std::size_t capacity) {
+  switch (codec) {
+#ifdef OMEGA_H_USE_ZLIB
+    case ZLIB_CODEC: {
+      uLong dest_bytes = static_cast<uLong>(capacity);
+      int ret = ::compress2(reinterpret_cast< ::Bytef*>(dst), &dest_bytes,
+          reinterpret_cast<const ::Bytef*>(src), static_cast<uLong>(nbytes),
+          Z_BEST_SPEED);
+      return (ret == Z_OK) ? static_cast<std::size_t>(dest_bytes) : 0;
+    }
+#endif
+#ifdef OMEGA_H_USE_LZ4
+    case LZ4_CODEC: {
+      int ret = ::LZ4_compress_default(src, dst, static_cast<int>(nbytes),
+          static_cast<int>(capacity));
+      return (ret > 0) ? static_cast<std::size_t>(ret) : 0;
+    }
+#endif
+#ifdef OMEGA_H_USE_ZSTD
+    case ZSTD_CODEC: {
+      auto ret = ::ZSTD_compress(dst, capacity, src, nbytes, 1);
+      return ::ZSTD_isError(ret) ? 0 : ret;
+    }
+#endif
+    default:
+      return 0;
+  }
+}
+
+bool decompress_block(Codec codec, char const* src, std::size_t nbytes,
+    char* dst, std::size_t expected_bytes) {
+  switch (codec) {
+#ifdef OMEGA_H_USE_ZLIB
+    case ZLIB_CODEC: {
+      uLong dest_bytes = static_cast<uLong>(expected_bytes);
+      int ret = ::uncompress(reinterpret_cast< ::Bytef*>(dst), &dest_bytes,
+          reinterpret_cast<const ::Bytef*>(src), static_cast<uLong>(nbytes));
+      return ret == Z_OK &&
+             dest_bytes == static_cast<uLong>(expected_bytes);
+    }
+#endif
+#ifdef OMEGA_H_USE_LZ4
+    case LZ4_CODEC: {
+      int ret = ::LZ4_decompress_safe(src, dst, static_cast<int>(nbytes),
+          static_cast<int>(expected_bytes));
+      return ret == static_cast<int>(expected_bytes);
+    }
+#endif
+#ifdef OMEGA_H_USE_ZSTD
+    case ZSTD_CODEC: {
+      auto ret = ::ZSTD_decompress(dst, expected_bytes, src, nbytes);
+      return ret == expected_bytes;
+    }
+#endif
+    default:
+      return false;
+  }
+}
+
+/* groups the n-th bytes of all (width)-byte values together,
+   which makes floating-point data much more compressible */
+void shuffle_bytes(
+    char const* in, char* out, std::size_t nbytes, std::size_t width) {
+  auto n = nbytes / width;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t b = 0; b < width; ++b) out[b * n + i] = in[i * width + b];
+  }
+}
+
+void unshuffle_bytes(
+    char const* in, char* out, std::size_t nbytes, std::size_t width) {
+  auto n = nbytes / width;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t b = 0; b < width; ++b) out[i * width + b] = in[b * n + i];
+  }
+}
+
+/* a whole file mapped into memory. the mapping is private
+   (copy-on-write), so arrays pointing into it behave like any
+   other array even though nothing is written back to the file */
+class MappedFile {
+ public:
+  explicit MappedFile(std::string const& path);
+  /* anonymous memory of (size) bytes for the caller to fill in,
+     such as one part read from a shared file */
+  explicit MappedFile(std::size_t size);
+  ~MappedFile();
+  MappedFile(MappedFile const&) = delete;
+  MappedFile& operator=(MappedFile const&) = delete;
+  char* data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+ private:
+  char* data_;
+  std::size_t size_;
+};
+
+MappedFile::MappedFile(std::string const& path) : data_(nullptr), size_(0) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    Omega_h_fail("could not open file \"%s\", got error \"%s\"\n",
+        path.c_str(), std::strerror(errno));
+  }
+  struct stat info;
+  OMEGA_H_CHECK(::fstat(fd, &info) == 0);
+  size_ = static_cast<std::size_t>(info.st_size);
+  if (size_ > 0) {
+    void* p =
+        ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (p == MAP_FAILED) {
+      Omega_h_fail("could not map file \"%s\", got error \"%s\"\n",
+          path.c_str(), std::strerror(errno));
+    }
+    data_ = static_cast<char*>(p);
+  }
+  ::close(fd);
+}
+
+MappedFile::MappedFile(std::size_t size) : data_(nullptr), size_(size) {
+  if (size_ > 0) {
+    void* p = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+      Omega_h_fail("could not allocate %zu bytes, got error \"%s\"\n", size_,
+          std::strerror(errno));
+    }
+    data_ = static_cast<char*>(p);
+  }
+}
+
+MappedFile::~MappedFile() {
+  if (data_) ::munmap(data_, size_);
+}
+
+/* lets the stream-based reader parse a mapped file, and lets
+   read_array recognize that it can point into the mapping
+   instead of copying.
+   the stream may also be just the bytes [begin, end) of the file,
+   such as one of several parts read into the same memory */
+class MappedBuf : public std::streambuf {
+ public:
+  explicit MappedBuf(std::shared_ptr<MappedFile> file) : file_(file) {
+    setg(file->data(), file->data(), file->data() + file->size());
+  }
+  MappedBuf(std::shared_ptr<MappedFile> file, std::size_t begin,
+      std::size_t end)
+      : file_(file) {
+    setg(file->data() + begin, file->data() + begin, file->data() + end);
+  }
+  std::shared_ptr<MappedFile> const& file() const { return file_; }
+  /* the current position relative to the start of the file */
+  std::size_t offset() const { return std::size_t(gptr() - file_->data()); }
+
+ protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+      std::ios_base::openmode which) override {
+    off_type base = 0;
+    if (dir == std::ios_base::cur) base = off_type(gptr() - eback());
+    if (dir == std::ios_base::end) base = off_type(egptr() - eback());
+    return seekpos(pos_type(base + off), which);
+  }
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+    auto off = off_type(pos);
+    if (!(which & std::ios_base::in) || off < 0 ||
+        off > off_type(egptr() - eback())) {
+      return pos_type(off_type(-1));
+    }
+    setg(eback(), eback() + off, egptr());
+    return pos;
+  }
+
+ private:
+  std::shared_ptr<MappedFile> file_;
+};
+
+MappedBuf* mapped_buf(std::istream& stream) {
+  return dynamic_cast<MappedBuf*>(stream.rdbuf());
+}
+
+/* collects the bytes written to a stream in one growing vector
+   whose storage can be handed to write_at_all as it is, unlike
+   std::ostringstream::str() which returns a copy of everything */
+class PartBuf : public std::streambuf {
+ public:
+  char const* data() const { return bytes_.data(); }
+  I64 size() const { return I64(bytes_.size()); }
+
+ protected:
+  std::streamsize xsputn(char const* s, std::streamsize n) override {
+    bytes_.insert(bytes_.end(), s, s + n);
+    return n;
+  }
+  int_type overflow(int_type c) override {
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+      bytes_.push_back(traits_type::to_char_type(c));
+    }
+    return traits_type::not_eof(c);
+  }
+  /* only reports the position, for tellp() */
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+      std::ios_base::openmode which) override {
+    if (off != 0 || dir != std::ios_base::cur ||
+        !(which & std::ios_base::out)) {
+      return pos_type(off_type(-1));
+    }
+    return pos_type(off_type(bytes_.size()));
+  }
+
+ private:
+  std::vector<char> bytes_;
+};
+
+/* one file read or written by all ranks of a communicator at once,
+   each rank at its own offsets. with MPI this is collective MPI-IO,
+   which lets the library aggregate the requests of many ranks,
+   otherwise each rank positions its own stream */
+class SharedFile {
+ public:
+  SharedFile(CommPtr comm, std::string const& path, bool is_writing);
+  ~SharedFile();
+  SharedFile(SharedFile const&) = delete;
+  SharedFile& operator=(SharedFile const&) = delete;
+  void write_at_all(I64 offset, char const* data, I64 nbytes);
+  void read_at_all(I64 offset, char* data, I64 nbytes);
+
+ private:
+  CommPtr comm_;
+#ifdef OMEGA_H_USE_MPI
+  MPI_File impl_;
+  /* MPI counts are ints, larger requests go in pieces of this size */
+  static constexpr I64 max_request_bytes = I64(1) << 30;
+  I64 get_nrequests(I64 nbytes) const;
+#else
+  std::fstream stream_;
+#endif
+};
+
+SharedFile::SharedFile(CommPtr comm, std::string const& path, bool is_writing)
+    : comm_(comm) {
+  /* replace rather than truncate, like the per-rank files */
+  if (is_writing && comm_->rank() == 0) std::remove(path.c_str());
+  comm_->barrier();
+#ifdef OMEGA_H_USE_MPI
+  auto mode =
+      is_writing ? (MPI_MODE_CREATE | MPI_MODE_WRONLY) : MPI_MODE_RDONLY;
+  auto err = MPI_File_open(comm_->get_impl(), path.c_str(), mode,
+      MPI_INFO_NULL, &impl_);
+  if (err != MPI_SUCCESS) {
+    Omega_h_fail("could not open file \"%s\"\n", path.c_str());
+  }
+#else
+  if (is_writing) {
+    if (comm_->rank() == 0) std::ofstream(path.c_str(), std::ios::binary);
+    comm_->barrier();
+    stream_.open(
+        path.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+  } else {
+    stream_.open(path.c_str(), std::ios::in | std::ios::binary);
+  }
+  if (!stream_.is_open()) {
+    Omega_h_fail("could not open file \"%s\"\n", path.c_str());
+  }
+#endif
+}
+
+SharedFile::~SharedFile() {
+#ifdef OMEGA_H_USE_MPI
+  MPI_File_close(&impl_);
+#else
+  stream_.close();
+  comm_->barrier();
+#endif
+}
+
+#ifdef OMEGA_H_USE_MPI
+I64 SharedFile::get_nrequests(I64 nbytes) const {
+  return comm_->allreduce(
+      (nbytes + max_request_bytes - 1) / max_request_bytes, OMEGA_H_MAX);
+}
+#endif
+
+void SharedFile::write_at_all(I64 offset, char const* data, I64 nbytes) {
+#ifdef OMEGA_H_USE_MPI
+  auto nrequests = get_nrequests(nbytes);
+  for (I64 i = 0; i < nrequests; ++i) {
+    auto begin = min2(i * max_request_bytes, nbytes);
+    auto end = min2(begin + max_request_bytes, nbytes);
+    auto err = MPI_File_write_at_all(impl_, MPI_Offset(offset + begin),
+        data + begin, int(end - begin), MPI_BYTE, MPI_STATUS_IGNORE);
+    OMEGA_H_CHECK(err == MPI_SUCCESS);
+  }
+#else
+  stream_.seekp(std::streamoff(offset));
+  stream_.write(data, std::streamsize(nbytes));
+  OMEGA_H_CHECK(stream_.good());
+#endif
+}
+
+void SharedFile::read_at_all(I64 offset, char* data, I64 nbytes) {
+#ifdef OMEGA_H_USE_MPI
+  auto nrequests = get_nrequests(nbytes);
+  for (I64 i = 0; i < nrequests; ++i) {
+    auto begin = min2(i * max_request_bytes, nbytes);
+    auto end = min2(begin + max_request_bytes, nbytes);
+    auto err = MPI_File_read_at_all(impl_, MPI_Offset(offset + begin),
+        data + begin, int(end - begin), MPI_BYTE, MPI_STATUS_IGNORE);
+    OMEGA_H_CHECK(err == MPI_SUCCESS);
+  }
+#else
+  if (nbytes == 0) return;
+  stream_.seekg(std::streamoff(offset));
+  stream_.read(data, std::streamsize(nbytes));
+  if (!stream_) Omega_h_fail("shared file ended before its last part\n");
+#endif
+}
+
 }  // end anonymous namespace
 
 template <typename T>
@@ -149,6 +531,24 @@ Read<T> swap_if_needed(Read<T> array, bool is_little_endian) {
   return out;
 }
 
+/* arrays that are already in native byte order and suitably
+   aligned are used in place, otherwise they are copied out */
+template <typename T>
+static Read<T> read_mapped_array(
+    std::shared_ptr<MappedFile> const& file, std::size_t offset, LO size) {
+  auto ptr = file->data() + offset;
+#ifndef OMEGA_H_USE_KOKKOSCORE
+  if (is_little_endian_cpu() &&
+      reinterpret_cast<std::uintptr_t>(ptr) % alignof(T) == 0) {
+    return Write<T>(size, std::shared_ptr<T>(file, reinterpret_cast<T*>(ptr)));
+  }
+#endif
+  HostWrite<T> copy(size);
+  std::memcpy(nonnull(copy.data()), ptr,
+      static_cast<std::size_t>(size) * sizeof(T));
+  return swap_if_needed(Read<T>(copy.write()), true);
+}
+
 template <typename T>
 void write_value(std::ostream& stream, T val) {
   swap_if_needed(val);
@@ -161,65 +561,195 @@ void read_value(std::istream& stream, T& val) {
   swap_if_needed(val);
 }
 
+bool codec_available(Codec codec) {
+  switch (codec) {
+    case NO_CODEC:
+#ifdef OMEGA_H_USE_ZLIB
+    case ZLIB_CODEC:
+#endif
+#ifdef OMEGA_H_USE_LZ4
+    case LZ4_CODEC:
+#endif
+#ifdef OMEGA_H_USE_ZSTD
+    case ZSTD_CODEC:
+#endif
+      return true;
+    default:
+      return false;
+  }
+}
+
+/* writes (nbytes) of (data) as independently compressed blocks,
+   preceded by the size of each compressed block so that readers
+   can locate and decompress them in parallel */
+static void write_blocks(std::ostream& stream, char const* data, I64 nbytes,
+    Codec codec, I8 shuffle_width) {
+  write_value(stream, shuffle_width);
+  I64 block_bytes = compression_block_bytes;
+  write_value(stream, block_bytes);
+  auto nblocks = (nbytes + block_bytes - 1) / block_bytes;
+  std::vector<std::vector<char>> blocks(static_cast<std::size_t>(nblocks));
+  std::vector<I8> failed(static_cast<std::size_t>(nblocks), 0);
+#ifdef OMEGA_H_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (I64 i = 0; i < nblocks; ++i) {
+    auto begin = i * block_bytes;
+    auto n = static_cast<std::size_t>(std::min(block_bytes, nbytes - begin));
+    char const* src = data + begin;
+    std::vector<char> shuffled;
+    if (shuffle_width) {
+      shuffled.resize(n);
+      shuffle_bytes(src, shuffled.data(), n, std::size_t(shuffle_width));
+      src = shuffled.data();
+    }
+    auto& block = blocks[std::size_t(i)];
+    block.resize(compress_bound(codec, n));
+    auto compressed_bytes =
+        compress_block(codec, src, n, block.data(), block.size());
+    failed[std::size_t(i)] = (compressed_bytes == 0);
+    block.resize(compressed_bytes);
+  }
+  for (auto f : failed) OMEGA_H_CHECK(!f);
+  for (auto& block : blocks) write_value(stream, I64(block.size()));
+  for (auto& block : blocks) {
+    stream.write(block.data(), static_cast<std::streamsize>(block.size()));
+  }
+}
+
+static void read_blocks(
+    std::istream& stream, char* data, I64 nbytes, Codec codec) {
+  if (!codec_available(codec)) {
+    Omega_h_fail("file uses codec %d, which is not available in this build\n",
+        int(codec));
+  }
+  I8 shuffle_width;
+  read_value(stream, shuffle_width);
+  OMEGA_H_CHECK(shuffle_width >= 0);
+  I64 block_bytes;
+  read_value(stream, block_bytes);
+  OMEGA_H_CHECK(block_bytes > 0);
+  auto nblocks = (nbytes + block_bytes - 1) / block_bytes;
+  std::vector<I64> offsets(static_cast<std::size_t>(nblocks + 1), 0);
+  for (I64 i = 0; i < nblocks; ++i) {
+    I64 compressed_bytes;
+    read_value(stream, compressed_bytes);
+    OMEGA_H_CHECK(compressed_bytes >= 0);
+    offsets[std::size_t(i + 1)] = offsets[std::size_t(i)] + compressed_bytes;
+  }
+  auto total_bytes = offsets[std::size_t(nblocks)];
+  std::vector<char> compressed;
+  char const* source;
+  auto buf = mapped_buf(stream);
+  if (buf) {
+    source = buf->file()->data() + buf->offset();
+    stream.seekg(total_bytes, std::ios_base::cur);
+  } else {
+    compressed.resize(static_cast<std::size_t>(total_bytes));
+    stream.read(compressed.data(), total_bytes);
+    source = compressed.data();
+  }
+  OMEGA_H_CHECK(stream);
+  std::vector<I8> failed(static_cast<std::size_t>(nblocks), 0);
+#ifdef OMEGA_H_USE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for (I64 i = 0; i < nblocks; ++i) {
+    auto begin = i * block_bytes;
+    auto n = static_cast<std::size_t>(std::min(block_bytes, nbytes - begin));
+    auto src = source + offsets[std::size_t(i)];
+    auto src_bytes = static_cast<std::size_t>(
+        offsets[std::size_t(i + 1)] - offsets[std::size_t(i)]);
+    bool ok;
+    if (shuffle_width) {
+      std::vector<char> shuffled(n);
+      ok = decompress_block(codec, src, src_bytes, shuffled.data(), n);
+      unshuffle_bytes(
+          shuffled.data(), data + begin, n, std::size_t(shuffle_width));
+    } else {
+      ok = decompress_block(codec, src, src_bytes, data + begin, n);
+    }
+    failed[std::size_t(i)] = !ok;
+  }
+  for (auto f : failed) OMEGA_H_CHECK(!f);
+}
+
+/* before version 8 there was one flag for the whole file, and
+   compressed arrays were a single zlib stream */
+static Codec read_codec(std::istream& stream, bool is_compressed, I32 version) {
+  if (version < 8) return is_compressed ? ZLIB_CODEC : NO_CODEC;
+  I8 codec;
+  read_value(stream, codec);
+  return Codec(codec);
+}
+
+template <typename T>
+static Read<T> read_array_contents(
+    std::istream& stream, LO size, Codec codec, I32 version) {
+  I64 uncompressed_bytes =
+      static_cast<I64>(static_cast<std::size_t>(size) * sizeof(T));
+  if (codec == NO_CODEC) {
+    if (version >= 7) skip_padding(stream);
+    auto buf = mapped_buf(stream);
+    if (buf) {
+      auto offset = buf->offset();
+      stream.seekg(uncompressed_bytes, std::ios_base::cur);
+      OMEGA_H_CHECK(stream);
+      return read_mapped_array<T>(buf->file(), offset, size);
+    }
+  }
+  HostWrite<T> uncompressed(size);
+  auto data = reinterpret_cast<char*>(nonnull(uncompressed.data()));
+  if (codec == NO_CODEC) {
+    stream.read(data, uncompressed_bytes);
+  } else if (version < 8) {
+#ifndef OMEGA_H_USE_ZLIB
+    Omega_h_fail("reading compressed files requires zlib\n");
+#endif
+    I64 compressed_bytes;
+    read_value(stream, compressed_bytes);
+    OMEGA_H_CHECK(compressed_bytes >= 0);
+    std::vector<char> compressed(static_cast<std::size_t>(compressed_bytes));
+    stream.read(compressed.data(), compressed_bytes);
+    OMEGA_H_CHECK(decompress_block(ZLIB_CODEC, compressed.data(),
+        compressed.size(), data, static_cast<std::size_t>(uncompressed_bytes)));
+  } else {
+    read_blocks(stream, data, uncompressed_bytes, codec);
+  }
+  return swap_if_needed(Read<T>(uncompressed.write()), true);
+}
+
 template <typename T>
-void write_array(std::ostream& stream, Read<T> array) {
+void write_array(std::ostream& stream, Read<T> array, Codec codec) {
+  if (!codec_available(codec)) {
+    Omega_h_fail("codec %d is not available in this build\n", int(codec));
+  }
   LO size = array.size();
   write_value(stream, size);
+  I8 codec_i8 = codec;
+  write_value(stream, codec_i8);
   Read<T> swapped = swap_if_needed(array, true);
   HostRead<T> uncompressed(swapped);
   I64 uncompressed_bytes =
       static_cast<I64>(static_cast<std::size_t>(size) * sizeof(T));
-#ifdef OMEGA_H_USE_ZLIB
-  uLong source_bytes = static_cast<uLong>(uncompressed_bytes);
-  uLong dest_bytes = ::compressBound(source_bytes);
-  auto compressed = new ::Bytef[dest_bytes];
-  int ret = ::compress2(compressed, &dest_bytes,
-      reinterpret_cast<const ::Bytef*>(nonnull(uncompressed.data())),
-      source_bytes, Z_BEST_SPEED);
-  OMEGA_H_CHECK(ret == Z_OK);
-  I64 compressed_bytes = static_cast<I64>(dest_bytes);
-  write_value(stream, compressed_bytes);
-  stream.write(reinterpret_cast<const char*>(compressed), compressed_bytes);
-  delete[] compressed;
-#else
-  stream.write(reinterpret_cast<const char*>(nonnull(uncompressed.data())),
-      uncompressed_bytes);
-#endif
+  auto data = reinterpret_cast<const char*>(nonnull(uncompressed.data()));
+  if (codec == NO_CODEC) {
+    write_padding(stream);
+    stream.write(data, uncompressed_bytes);
+  } else {
+    auto shuffle_width = std::is_same<T, Real>::value ? I8(sizeof(T)) : I8(0);
+    write_blocks(stream, data, uncompressed_bytes, codec, shuffle_width);
+  }
 }
 
 template <typename T>
-void read_array(std::istream& stream, Read<T>& array, bool is_compressed) {
+void read_array(
+    std::istream& stream, Read<T>& array, bool is_compressed, I32 version) {
   LO size;
   read_value(stream, size);
   OMEGA_H_CHECK(size >= 0);
-  I64 uncompressed_bytes =
-      static_cast<I64>(static_cast<std::size_t>(size) * sizeof(T));
-  HostWrite<T> uncompressed(size);
-#ifdef OMEGA_H_USE_ZLIB
-  if (is_compressed) {
-    I64 compressed_bytes;
-    read_value(stream, compressed_bytes);
-    OMEGA_H_CHECK(compressed_bytes >= 0);
-    auto compressed = new ::Bytef[compressed_bytes];
-    stream.read(reinterpret_cast<char*>(compressed), compressed_bytes);
-    uLong dest_bytes = static_cast<uLong>(uncompressed_bytes);
-    uLong source_bytes = static_cast<uLong>(compressed_bytes);
-    ::Bytef* uncompressed_ptr =
-        reinterpret_cast< ::Bytef*>(nonnull(uncompressed.data()));
-    int ret =
-        ::uncompress(uncompressed_ptr, &dest_bytes, compressed, source_bytes);
-    OMEGA_H_CHECK(ret == Z_OK);
-    OMEGA_H_CHECK(dest_bytes == static_cast<uLong>(uncompressed_bytes));
-    delete[] compressed;
-  } else
-#else
-  OMEGA_H_CHECK(is_compressed == false);
-#endif
-  {
-    stream.read(reinterpret_cast<char*>(nonnull(uncompressed.data())),
-        uncompressed_bytes);
-  }
-  array = swap_if_needed(Read<T>(uncompressed.write()), true);
+  auto codec = read_codec(stream, is_compressed, version);
+  array = read_array_contents<T>(stream, size, codec, version);
 }
 
 void write(std::ostream& stream, std::string const& val) {
@@ -259,16 +789,19 @@ static void write_meta(std::ostream& stream, Mesh const* mesh) {
   }
 }
 
-static void read_meta(std::istream& stream, Mesh* mesh, Int version) {
+/* returns the size of the communicator the part was written from,
+   which must be that of (mesh) unless (is_merging) */
+static I32 read_meta(
+    std::istream& stream, Mesh* mesh, Int version, bool is_merging) {
   I8 dim;
   read_value(stream, dim);
   mesh->set_dim(Int(dim));
   I32 comm_size;
   read_value(stream, comm_size);
-  OMEGA_H_CHECK(mesh->comm()->size() == comm_size);
+  OMEGA_H_CHECK(is_merging || mesh->comm()->size() == comm_size);
   I32 comm_rank;
   read_value(stream, comm_rank);
-  OMEGA_H_CHECK(mesh->comm()->rank() == comm_rank);
+  OMEGA_H_CHECK(is_merging || mesh->comm()->rank() == comm_rank);
   I8 parting_i8;
   read_value(stream, parting_i8);
   OMEGA_H_CHECK(parting_i8 == I8(OMEGA_H_ELEM_BASED) ||
@@ -298,9 +831,10 @@ static void read_meta(std::istream& stream, Mesh* mesh, Int version) {
     I8 keeps_canon;
     read_value(stream, keeps_canon);
   }
+  return comm_size;
 }
 
-static void write_tag(std::ostream& stream, TagBase const* tag) {
+static void write_tag(std::ostream& stream, TagBase const* tag, Codec codec) {
   std::string name = tag->name();
   write(stream, name);
   auto ncomps = I8(tag->ncomps());
@@ -308,18 +842,46 @@ static void write_tag(std::ostream& stream, TagBase const* tag) {
   I8 type = tag->type();
   write_value(stream, type);
   if (is<I8>(tag)) {
-    write_array(stream, as<I8>(tag)->array());
+    write_array(stream, as<I8>(tag)->array(), codec);
   } else if (is<I32>(tag)) {
-    write_array(stream, as<I32>(tag)->array());
+    write_array(stream, as<I32>(tag)->array(), codec);
   } else if (is<I64>(tag)) {
-    write_array(stream, as<I64>(tag)->array());
+    write_array(stream, as<I64>(tag)->array(), codec);
   } else if (is<Real>(tag)) {
-    write_array(stream, as<Real>(tag)->array());
+    write_array(stream, as<Real>(tag)->array(), codec);
   } else {
     Omega_h_fail("unexpected tag type in binary write\n");
   }
 }
 
+/* uncompressed tags in a mapped file are not touched until
+   someone asks for them, which keeps opening a large mesh
+   proportional to its metadata */
+template <typename T>
+static void read_tag_array(std::istream& stream, Mesh* mesh, Int d,
+    std::string const& name, Int ncomps, bool is_compressed, I32 version) {
+  LO size;
+  read_value(stream, size);
+  OMEGA_H_CHECK(size == mesh->nents(d) * ncomps);
+  auto codec = read_codec(stream, is_compressed, version);
+  auto buf = mapped_buf(stream);
+  if (buf && codec == NO_CODEC) {
+    if (version >= 7) skip_padding(stream);
+    auto file = buf->file();
+    auto offset = buf->offset();
+    stream.seekg(
+        static_cast<std::streamoff>(size) * std::streamoff(sizeof(T)),
+        std::ios_base::cur);
+    OMEGA_H_CHECK(stream);
+    mesh->add_lazy_tag<T>(d, name, ncomps, [file, offset, size]() {
+      return read_mapped_array<T>(file, offset, size);
+    });
+    return;
+  }
+  auto array = read_array_contents<T>(stream, size, codec, version);
+  mesh->add_tag(d, name, ncomps, array, true);
+}
+
 static void read_tag(
     std::istream& stream, Mesh* mesh, Int d, bool is_compressed, I32 version) {
   std::string name;
@@ -337,62 +899,57 @@ static void read_tag(
     }
   }
   if (type == OMEGA_H_I8) {
-    Read<I8> array;
-    read_array(stream, array, is_compressed);
-    mesh->add_tag(d, name, ncomps, array, true);
+    read_tag_array<I8>(stream, mesh, d, name, ncomps, is_compressed, version);
   } else if (type == OMEGA_H_I32) {
-    Read<I32> array;
-    read_array(stream, array, is_compressed);
-    mesh->add_tag(d, name, ncomps, array, true);
+    read_tag_array<I32>(stream, mesh, d, name, ncomps, is_compressed, version);
   } else if (type == OMEGA_H_I64) {
-    Read<I64> array;
-    read_array(stream, array, is_compressed);
-    mesh->add_tag(d, name, ncomps, array, true);
+    read_tag_array<I64>(stream, mesh, d, name, ncomps, is_compressed, version);
   } else if (type == OMEGA_H_F64) {
-    Read<Real> array;
-    read_array(stream, array, is_compressed);
-    mesh->add_tag(d, name, ncomps, array, true);
+    read_tag_array<Real>(
+        stream, mesh, d, name, ncomps, is_compressed, version);
   } else {
     Omega_h_fail("unexpected tag type in binary read\n");
   }
 }
 
-void write(std::ostream& stream, Mesh* mesh) {
+void write(std::ostream& stream, Mesh* mesh, Codec codec) {
   begin_code("binary::write(stream,Mesh)");
   stream.write(reinterpret_cast<const char*>(magic), sizeof(magic));
 // write_value(stream, latest_version); moved to /version at version 4
-#ifdef OMEGA_H_USE_ZLIB
-  I8 is_compressed = true;
-#else
-  I8 is_compressed = false;
-#endif
+  /* since version 8 each array records its own codec */
+  I8 is_compressed = (codec != NO_CODEC);
   write_value(stream, is_compressed);
   write_meta(stream, mesh);
   LO nverts = mesh->nverts();
   write_value(stream, nverts);
   for (Int d = 1; d <= mesh->dim(); ++d) {
     auto down = mesh->ask_down(d, d - 1);
-    write_array(stream, down.ab2b);
+    write_array(stream, down.ab2b, codec);
     if (d > 1) {
-      write_array(stream, down.codes);
+      write_array(stream, down.codes, codec);
     }
   }
   for (Int d = 0; d <= mesh->dim(); ++d) {
     auto nsaved_tags = mesh->ntags(d);
     write_value(stream, nsaved_tags);
     for (Int i = 0; i < mesh->ntags(d); ++i) {
-      write_tag(stream, mesh->get_tag(d, i));
+      write_tag(stream, mesh->get_tag(d, i), codec);
     }
     if (mesh->comm()->size() > 1) {
       auto owners = mesh->ask_owners(d);
-      write_array(stream, owners.ranks);
-      write_array(stream, owners.idxs);
+      write_array(stream, owners.ranks, codec);
+      write_array(stream, owners.idxs, codec);
     }
   }
   end_code();
 }
 
-void read(std::istream& stream, Mesh* mesh, I32 version) {
+/* with (owners) given, the part may be one of a file written by
+   any number of ranks: (mesh) keeps its own communicator and the
+   owners of each dimension, if the file has them, are appended
+   to (owners) instead of being set on the mesh */
+static void read_part(std::istream& stream, Mesh* mesh, I32 version,
+    std::vector<Remotes>* owners) {
   unsigned char magic_in[2];
   stream.read(reinterpret_cast<char*>(magic_in), sizeof(magic));
   OMEGA_H_CHECK(magic_in[0] == magic[0]);
@@ -403,17 +960,17 @@ void read(std::istream& stream, Mesh* mesh, I32 version) {
   I8 is_compressed;
   read_value(stream, is_compressed);
 #ifndef OMEGA_H_USE_ZLIB
-  OMEGA_H_CHECK(!is_compressed);
+  if (version < 8) OMEGA_H_CHECK(!is_compressed);
 #endif
-  read_meta(stream, mesh, version);
+  auto comm_size = read_meta(stream, mesh, version, owners != nullptr);
   LO nverts;
   read_value(stream, nverts);
   mesh->set_verts(nverts);
   for (Int d = 1; d <= mesh->dim(); ++d) {
     Adj down;
-    read_array(stream, down.ab2b, is_compressed);
+    read_array(stream, down.ab2b, is_compressed, version);
     if (d > 1) {
-      read_array(stream, down.codes, is_compressed);
+      read_array(stream, down.codes, is_compressed, version);
     }
     mesh->set_ents(d, down);
   }
@@ -423,15 +980,23 @@ void read(std::istream& stream, Mesh* mesh, I32 version) {
     for (Int i = 0; i < ntags; ++i) {
       read_tag(stream, mesh, d, is_compressed, version);
     }
-    if (mesh->comm()->size() > 1) {
-      Remotes owners;
-      read_array(stream, owners.ranks, is_compressed);
-      read_array(stream, owners.idxs, is_compressed);
-      mesh->set_owners(d, owners);
+    if (comm_size > 1) {
+      Remotes part_owners;
+      read_array(stream, part_owners.ranks, is_compressed, version);
+      read_array(stream, part_owners.idxs, is_compressed, version);
+      if (owners) {
+        owners->push_back(part_owners);
+      } else {
+        mesh->set_owners(d, part_owners);
+      }
     }
   }
 }
 
+void read(std::istream& stream, Mesh* mesh, I32 version) {
+  read_part(stream, mesh, version, nullptr);
+}
+
 static void write_int_file(std::string const& filepath, Mesh* mesh, I32 value) {
   if (mesh->comm()->rank() == 0) {
     std::ofstream file(filepath.c_str());
@@ -448,17 +1013,49 @@ static void write_version(std::string const& path, Mesh* mesh) {
   write_int_file(path + "/version", mesh, latest_version);
 }
 
+/* a shared file begins with the magic number, the version and the
+   number of parts, followed by the offset of each part and then the
+   offset of the end of the file. each part is what
+   write(std::ostream&) writes for one rank, and starts at a
+   multiple of array_alignment */
+constexpr I64 shared_header_bytes = 2 + 4 + 4;
+
+static bool is_shared_file(std::string const& path) {
+  struct stat info;
+  return ::stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode);
+}
+
+static void read_shared_header(
+    std::string const& path, I32* version, I32* nparts) {
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file.is_open()) {
+    Omega_h_fail("could not open file \"%s\"\n", path.c_str());
+  }
+  unsigned char magic_in[2];
+  file.read(reinterpret_cast<char*>(magic_in), sizeof(magic));
+  read_value(file, *version);
+  read_value(file, *nparts);
+  if (!file || magic_in[0] != magic[0] || magic_in[1] != magic[1]) {
+    Omega_h_fail("\"%s\" is not an Omega_h file\n", path.c_str());
+  }
+}
+
 I32 read_nparts(std::string const& path, CommPtr comm) {
   I32 nparts;
   if (comm->rank() == 0) {
-    auto filepath = path + "/nparts";
-    std::ifstream file(filepath.c_str());
-    if (!file.is_open()) {
-      Omega_h_fail("could not open file \"%s\"\n", filepath.c_str());
-    }
-    file >> nparts;
-    if (!file) {
-      Omega_h_fail("could not read file \"%s\"\n", filepath.c_str());
+    if (is_shared_file(path)) {
+      I32 version;
+      read_shared_header(path, &version, &nparts);
+    } else {
+      auto filepath = path + "/nparts";
+      std::ifstream file(filepath.c_str());
+      if (!file.is_open()) {
+        Omega_h_fail("could not open file \"%s\"\n", filepath.c_str());
+      }
+      file >> nparts;
+      if (!file) {
+        Omega_h_fail("could not read file \"%s\"\n", filepath.c_str());
+      }
     }
   }
   comm->bcast(nparts);
@@ -468,14 +1065,19 @@ I32 read_nparts(std::string const& path, CommPtr comm) {
 I32 read_version(std::string const& path, CommPtr comm) {
   I32 version;
   if (comm->rank() == 0) {
-    auto filepath = path + "/version";
-    std::ifstream file(filepath.c_str());
-    if (!file.is_open()) {
-      version = -1;
+    if (is_shared_file(path)) {
+      I32 nparts;
+      read_shared_header(path, &version, &nparts);
     } else {
-      file >> version;
-      if (!file) {
-        Omega_h_fail("could not read file \"%s\"\n", filepath.c_str());
+      auto filepath = path + "/version";
+      std::ifstream file(filepath.c_str());
+      if (!file.is_open()) {
+        version = -1;
+      } else {
+        file >> version;
+        if (!file) {
+          Omega_h_fail("could not read file \"%s\"\n", filepath.c_str());
+        }
       }
     }
   }
@@ -483,7 +1085,7 @@ I32 read_version(std::string const& path, CommPtr comm) {
   return version;
 }
 
-void write(std::string const& path, Mesh* mesh) {
+void write(std::string const& path, Mesh* mesh, Codec codec) {
   begin_code("binary::write(path,Mesh)");
   if (!ends_with(path, ".osh") && can_print(mesh)) {
     std::cout
@@ -493,9 +1095,12 @@ void write(std::string const& path, Mesh* mesh) {
   safe_mkdir(path.c_str());
   mesh->comm()->barrier();
   auto filepath = path + "/" + to_string(mesh->comm()->rank()) + ".osh";
+  /* replace rather than truncate, meshes read from the old file
+     may still have it mapped */
+  std::remove(filepath.c_str());
   std::ofstream file(filepath.c_str());
   OMEGA_H_CHECK(file.is_open());
-  write(file, mesh);
+  write(file, mesh, codec);
   write_nparts(path, mesh);
   write_version(path, mesh);
   mesh->comm()->barrier();
@@ -507,23 +1112,311 @@ void read_in_comm(
   mesh->set_comm(comm);
   auto filepath = path + "/" + to_string(mesh->comm()->rank());
   if (version != -1) filepath += ".osh";
-  std::ifstream file(filepath.c_str());
-  OMEGA_H_CHECK(file.is_open());
-  read(file, mesh, version);
+  MappedBuf buf(std::make_shared<MappedFile>(filepath));
+  std::istream stream(&buf);
+  read(stream, mesh, version);
+}
+
+void write_shared(std::string const& path, Mesh* mesh, Codec codec) {
+  begin_code("binary::write_shared");
+  auto comm = mesh->comm();
+  struct stat info;
+  if (comm->rank() == 0 && ::stat(path.c_str(), &info) == 0 &&
+      S_ISDIR(info.st_mode)) {
+    Omega_h_fail("\"%s\" is a directory, not replacing it with a file\n",
+        path.c_str());
+  }
+  PartBuf part;
+  std::ostream part_stream(&part);
+  write(part_stream, mesh, codec);
+  auto part_bytes = part.size();
+  auto rank = comm->rank();
+  auto nparts = comm->size();
+  /* parts start at multiples of array_alignment, so a rank that reads
+     several of them into one buffer still maps their arrays in place */
+  auto table_end = shared_header_bytes + I64(nparts + 1) * I64(sizeof(I64));
+  auto padded_bytes = part_bytes + I64(alignment_padding(part_bytes));
+  auto part_begin = table_end + I64(alignment_padding(table_end)) +
+                    comm->exscan(padded_bytes, OMEGA_H_SUM);
+  /* each rank writes its own entry of the offset table,
+     rank 0 also writes the header before it
+     and the last rank the end of the file after it */
+  std::ostringstream table_stream;
+  if (rank == 0) {
+    table_stream.write(reinterpret_cast<const char*>(magic), sizeof(magic));
+    write_value(table_stream, latest_version);
+    write_value(table_stream, nparts);
+  }
+  write_value(table_stream, part_begin);
+  if (rank == nparts - 1) write_value(table_stream, part_begin + part_bytes);
+  auto table = table_stream.str();
+  auto entry_begin =
+      (rank == 0) ? I64(0) : shared_header_bytes + I64(rank) * I64(sizeof(I64));
+  {
+    SharedFile file(comm, path, true);
+    file.write_at_all(entry_begin, table.data(), I64(table.size()));
+    file.write_at_all(part_begin, part.data(), part_bytes);
+  }
+  comm->barrier();
+  end_code();
+}
+
+/* the parts [*begin, *end) that (rank) reads: with at least as many
+   ranks as parts, part (rank) or none, otherwise a contiguous slice
+   of parts for every rank */
+static void get_part_range(
+    I32 nparts, I32 comm_size, I32 rank, I32* begin, I32* end) {
+  if (nparts <= comm_size) {
+    *begin = min2(rank, nparts);
+    *end = min2(rank + 1, nparts);
+  } else {
+    *begin = I32((I64(nparts) * rank) / comm_size);
+    *end = I32((I64(nparts) * (rank + 1)) / comm_size);
+  }
+}
+
+/* the rank that reads (part) when there are more parts than ranks */
+static OMEGA_H_INLINE I32 get_part_reader(I32 nparts, I32 comm_size, I32 part) {
+  return I32((I64(part + 1) * comm_size - 1) / nparts);
+}
+
+/* reads parts [begin, end) of a shared file into one buffer,
+   part (begin + i) being bytes [(*offsets)[i], (*offsets)[i + 1]) */
+static std::shared_ptr<MappedFile> read_shared_parts(std::string const& path,
+    CommPtr comm, I32 begin, I32 end, std::vector<std::size_t>* offsets) {
+  SharedFile file(comm, path, false);
+  auto nentries = (end > begin) ? (end - begin + 1) : 0;
+  std::vector<I64> entries(std::size_t(nentries), 0);
+  auto entries_begin = shared_header_bytes + I64(begin) * I64(sizeof(I64));
+  file.read_at_all(entries_begin, reinterpret_cast<char*>(entries.data()),
+      I64(nentries) * I64(sizeof(I64)));
+  for (auto& entry : entries) swap_if_needed(entry);
+  auto first = entries.empty() ? I64(0) : entries.front();
+  auto last = entries.empty() ? I64(0) : entries.back();
+  auto parts = std::make_shared<MappedFile>(std::size_t(last - first));
+  file.read_at_all(first, parts->data(), last - first);
+  offsets->clear();
+  for (auto entry : entries) offsets->push_back(std::size_t(entry - first));
+  return parts;
+}
+
+template <typename T>
+static Read<T> concat_parts(std::vector<Read<T>> const& part_arrays,
+    std::vector<T> const& part_shifts) {
+  LO size = 0;
+  for (auto& a : part_arrays) size += a.size();
+  HostWrite<T> out(size);
+  LO i = 0;
+  for (std::size_t k = 0; k < part_arrays.size(); ++k) {
+    auto a = HostRead<T>(part_arrays[k]);
+    auto shift = part_shifts.empty() ? T(0) : part_shifts[k];
+    for (LO j = 0; j < a.size(); ++j) out[i++] = a[j] + shift;
+  }
+  return out.write();
+}
+
+template <typename T>
+static void merge_tag(Mesh* mesh, std::vector<Mesh>& parts, Int d,
+    std::string const& name, Int ncomps, LOs merged2copies) {
+  std::vector<Read<T>> part_arrays;
+  for (auto& part : parts) {
+    auto matches = part.has_tag(d, name) &&
+                   part.get_tagbase(d, name)->ncomps() == ncomps &&
+                   is<T>(part.get_tagbase(d, name));
+    if (!matches) {
+      Omega_h_fail("tag \"%s\" differs between parts\n", name.c_str());
+    }
+    part_arrays.push_back(part.get_array<T>(d, name));
+  }
+  auto copies = concat_parts(part_arrays, std::vector<T>());
+  mesh->add_tag(d, name, ncomps, unmap(merged2copies, copies, ncomps), true);
+}
+
+/* merges (parts), whose entities are numbered by their "global" tags,
+   into (mesh). parts that share an entity each have a copy of it,
+   of which the owner's copy is kept if it is among (parts), and the
+   new owner is the rank that read the old owner's part.
+   (owners) holds the old owners of each part by dimension and
+   (part_ids) which part each one is */
+static void merge_parts(Mesh* mesh, std::vector<Mesh>& parts,
+    std::vector<std::vector<Remotes>> const& owners,
+    std::vector<I32> const& part_ids, I32 nparts) {
+  auto comm = mesh->comm();
+  auto& first = parts.front();
+  auto dim = first.dim();
+  mesh->set_parting(first.parting(), first.nghost_layers(), false);
+  mesh->set_dim(dim);
+  mesh->set_rib_hints(first.rib_hints());
+  auto nparts_here = parts.size();
+  LOs lows2merged;
+  for (Int d = 0; d <= dim; ++d) {
+    std::vector<Read<GO>> part_globals;
+    std::vector<Read<I8>> part_owned;
+    std::vector<Read<I32>> part_own_ranks;
+    std::vector<LO> part_starts;
+    LO ncopies = 0;
+    for (std::size_t k = 0; k < nparts_here; ++k) {
+      auto& part = parts[k];
+      part_starts.push_back(ncopies);
+      ncopies += part.nents(d);
+      part_globals.push_back(part.get_array<GO>(d, "global"));
+      auto part_id = part_ids[k];
+      auto ranks = owners[k][std::size_t(d)].ranks;
+      auto idxs = owners[k][std::size_t(d)].idxs;
+      Write<I8> is_owned(part.nents(d));
+      Write<I32> own_ranks(part.nents(d));
+      auto comm_size = comm->size();
+      auto f = OMEGA_H_LAMBDA(LO e) {
+        is_owned[e] = (ranks[e] == part_id && idxs[e] == e);
+        own_ranks[e] = get_part_reader(nparts, comm_size, ranks[e]);
+      };
+      parallel_for(part.nents(d), f, "merge_parts(owners)");
+      part_owned.push_back(is_owned);
+      part_own_ranks.push_back(own_ranks);
+    }
+    auto copies2globals = concat_parts(part_globals, std::vector<GO>());
+    auto copies_owned = concat_parts(part_owned, std::vector<I8>());
+    /* sorting by global number, owner copies first */
+    Write<GO> keys(ncopies * 2);
+    auto f = OMEGA_H_LAMBDA(LO c) {
+      keys[c * 2 + 0] = copies2globals[c];
+      keys[c * 2 + 1] = copies_owned[c] ? 0 : 1;
+    };
+    parallel_for(ncopies, f, "merge_parts(keys)");
+    auto perm = sort_by_keys(GOs(keys), 2);
+    Write<I8> is_first(ncopies);
+    auto g = OMEGA_H_LAMBDA(LO i) {
+      is_first[i] = (i == 0) ||
+                    (copies2globals[perm[i]] != copies2globals[perm[i - 1]]);
+    };
+    parallel_for(ncopies, g, "merge_parts(first)");
+    auto first_offsets = offset_scan(Read<I8>(is_first));
+    auto nmerged = first_offsets.last();
+    Write<LO> copies2merged(ncopies);
+    Write<LO> merged2copies(nmerged);
+    auto h = OMEGA_H_LAMBDA(LO i) {
+      auto merged = first_offsets[i + 1] - 1;
+      copies2merged[perm[i]] = merged;
+      if (is_first[i]) merged2copies[merged] = perm[i];
+    };
+    parallel_for(ncopies, h, "merge_parts(map)");
+    if (d == VERT) {
+      mesh->set_verts(nmerged);
+    } else {
+      auto deg = simplex_degrees[d][d - 1];
+      std::vector<Read<LO>> part_down;
+      std::vector<Read<I8>> part_codes;
+      std::vector<LO> part_lows_starts;
+      LO nlows = 0;
+      for (auto& part : parts) {
+        auto down = part.ask_down(d, d - 1);
+        part_down.push_back(down.ab2b);
+        if (d > 1) part_codes.push_back(down.codes);
+        part_lows_starts.push_back(nlows);
+        nlows += part.nents(d - 1);
+      }
+      auto copies2lows = concat_parts(part_down, part_lows_starts);
+      Adj down;
+      down.ab2b = unmap(unmap(LOs(merged2copies), copies2lows, deg),
+          lows2merged, 1);
+      if (d > 1) {
+        auto copies_codes = concat_parts(part_codes, std::vector<I8>());
+        down.codes = unmap(LOs(merged2copies), copies_codes, deg);
+      }
+      mesh->set_ents(d, down);
+    }
+    for (Int i = 0; i < first.ntags(d); ++i) {
+      auto tag = first.get_tag(d, i);
+      auto const& name = tag->name();
+      auto ncomps = tag->ncomps();
+      if (is<I8>(tag)) {
+        merge_tag<I8>(mesh, parts, d, name, ncomps, merged2copies);
+      } else if (is<I32>(tag)) {
+        merge_tag<I32>(mesh, parts, d, name, ncomps, merged2copies);
+      } else if (is<I64>(tag)) {
+        merge_tag<I64>(mesh, parts, d, name, ncomps, merged2copies);
+      } else if (is<Real>(tag)) {
+        merge_tag<Real>(mesh, parts, d, name, ncomps, merged2copies);
+      }
+    }
+    if (comm->size() > 1) {
+      auto copies2own_ranks = concat_parts(part_own_ranks, std::vector<I32>());
+      auto own_ranks = unmap(LOs(merged2copies), copies2own_ranks, 1);
+      auto globals = mesh->get_array<GO>(d, "global");
+      mesh->set_owners(d, owners_from_globals(comm, globals, own_ranks));
+    }
+    lows2merged = copies2merged;
+  }
+  /* the union of ghosted parts has more ghosts than asked for */
+  auto parting = mesh->parting();
+  if (parting != OMEGA_H_ELEM_BASED) {
+    auto nlayers = mesh->nghost_layers();
+    mesh->set_parting(OMEGA_H_ELEM_BASED);
+    mesh->set_parting(parting, nlayers, false);
+  }
+}
+
+/* reads parts [begin, end) of (path) into meshes on one rank each */
+static void read_parts(std::string const& path, CommPtr comm, I32 version,
+    bool is_shared, I32 begin, I32 end, std::vector<Mesh>* parts,
+    std::vector<std::vector<Remotes>>* owners) {
+  std::shared_ptr<MappedFile> shared_parts;
+  std::vector<std::size_t> offsets;
+  if (is_shared) {
+    shared_parts = read_shared_parts(path, comm, begin, end, &offsets);
+  }
+  for (auto part = begin; part < end; ++part) {
+    parts->push_back(Mesh(comm->library()));
+    owners->push_back(std::vector<Remotes>());
+    auto mesh = &parts->back();
+    mesh->set_comm(comm->library()->self());
+    std::unique_ptr<MappedBuf> buf;
+    if (is_shared) {
+      auto i = std::size_t(part - begin);
+      buf.reset(new MappedBuf(shared_parts, offsets[i], offsets[i + 1]));
+    } else {
+      auto filepath = path + "/" + to_string(part);
+      if (version != -1) filepath += ".osh";
+      buf.reset(new MappedBuf(std::make_shared<MappedFile>(filepath)));
+    }
+    std::istream stream(buf.get());
+    read_part(stream, mesh, version, &owners->back());
+  }
 }
 
 I32 read(std::string const& path, CommPtr comm, Mesh* mesh) {
   auto nparts = read_nparts(path, comm);
   auto version = read_version(path, comm);
+  I8 is_shared = (comm->rank() == 0) && is_shared_file(path);
+  comm->bcast(is_shared);
+  I32 begin, end;
+  get_part_range(nparts, comm->size(), comm->rank(), &begin, &end);
   if (nparts > comm->size()) {
-    Omega_h_fail(
-        "path \"%s\" contains %d parts, but only %d ranks are reading it\n",
-        path.c_str(), nparts, comm->size());
+    std::vector<Mesh> parts;
+    std::vector<std::vector<Remotes>> owners;
+    read_parts(path, comm, version, is_shared, begin, end, &parts, &owners);
+    std::vector<I32> part_ids;
+    for (auto part = begin; part < end; ++part) part_ids.push_back(part);
+    mesh->set_comm(comm);
+    merge_parts(mesh, parts, owners, part_ids, nparts);
+    return nparts;
+  }
+  std::shared_ptr<MappedFile> shared_parts;
+  std::vector<std::size_t> offsets;
+  if (is_shared) {
+    shared_parts = read_shared_parts(path, comm, begin, end, &offsets);
   }
   auto in_subcomm = (comm->rank() < nparts);
   auto subcomm = comm->split(I32(!in_subcomm), 0);
   if (in_subcomm) {
-    read_in_comm(path, subcomm, mesh, version);
+    if (is_shared) {
+      mesh->set_comm(subcomm);
+      MappedBuf buf(shared_parts);
+      std::istream stream(&buf);
+      read(stream, mesh, version);
+    } else {
+      read_in_comm(path, subcomm, mesh, version);
+    }
   }
   mesh->set_comm(comm);
   return nparts;
@@ -534,9 +1427,10 @@ I32 read(std::string const& path, CommPtr comm, Mesh* mesh) {
   template Read<T> swap_if_needed(Read<T> array, bool is_little_endian);       \
   template void write_value(std::ostream& stream, T val);                      \
   template void read_value(std::istream& stream, T& val);                      \
-  template void write_array(std::ostream& stream, Read<T> array);              \
-  template void read_array(                                                    \
-      std::istream& stream, Read<T>& array, bool is_compressed);
+  template void write_array(                                                   \
+      std::ostream& stream, Read<T> array, Codec codec);                       \
+  template void read_array(std::istream& stream, Read<T>& array,               \
+      bool is_compressed, I32 version);
 OMEGA_H_INST(I8)
 OMEGA_H_INST(I32)
 OMEGA_H_INST(I64)
@@ -96,14 +96,44 @@ class FullWriter {
 
 namespace binary {
 
-void write(std::string const& path, Mesh* mesh);
+/* how array contents are stored in .osh files.
+   these values are written to files and must not change */
+enum Codec : I8 {
+  NO_CODEC = 0,
+  ZLIB_CODEC = 1,
+  LZ4_CODEC = 2,
+  ZSTD_CODEC = 3,
+};
+
+#ifdef OMEGA_H_USE_ZLIB
+constexpr Codec default_codec = ZLIB_CODEC;
+#else
+constexpr Codec default_codec = NO_CODEC;
+#endif
+
+bool codec_available(Codec codec);
+
+/* files written with NO_CODEC are larger, but they are read by
+   mapping them into memory: arrays point into the mapped pages and
+   tags are only loaded when they are first asked for */
+void write(std::string const& path, Mesh* mesh, Codec codec = default_codec);
+/* writes all parts into the single file (path) instead of one file
+   per rank in a directory, with collective MPI-IO when available.
+   read() recognizes such a file */
+void write_shared(
+    std::string const& path, Mesh* mesh, Codec codec = default_codec);
+/* reads onto any number of ranks and returns the number of parts.
+   with more ranks than parts, the extra ranks are left empty.
+   with fewer, each rank reads a contiguous slice of parts and merges
+   them by global numbers. either way the elements are where the
+   parts put them until the mesh is balanced */
 I32 read(std::string const& path, CommPtr comm, Mesh* mesh);
 I32 read_nparts(std::string const& path, CommPtr comm);
 I32 read_version(std::string const& path, CommPtr comm);
 void read_in_comm(
     std::string const& path, CommPtr comm, Mesh* mesh, I32 version);
 
-constexpr I32 latest_version = 6;
+constexpr I32 latest_version = 8;
 
 template <typename T>
 void swap_if_needed(T& val, bool is_little_endian = true);
@@ -115,14 +145,16 @@ void write_value(std::ostream& stream, T val);
 template <typename T>
 void read_value(std::istream& stream, T& val);
 template <typename T>
-void write_array(std::ostream& stream, Read<T> array);
+void write_array(
+    std::ostream& stream, Read<T> array, Codec codec = default_codec);
 template <typename T>
-void read_array(std::istream& stream, Read<T>& array, bool is_compressed);
+void read_array(std::istream& stream, Read<T>& array, bool is_compressed,
+    I32 version = latest_version);
 
 void write(std::ostream& stream, std::string const& val);
 void read(std::istream& stream, std::string& val);
 
-void write(std::ostream& stream, Mesh* mesh);
+void write(std::ostream& stream, Mesh* mesh, Codec codec = default_codec);
 void read(std::istream& stream, Mesh* mesh, I32 version);
 
 #define INST_DECL(T)                                                           \
@@ -131,9 +163,10 @@ void read(std::istream& stream, Mesh* mesh, I32 version);
       Read<T> array, bool is_little_endian);                                   \
   extern template void write_value(std::ostream& stream, T val);               \
   extern template void read_value(std::istream& stream, T& val);               \
-  extern template void write_array(std::ostream& stream, Read<T> array);       \
-  extern template void read_array(                                             \
-      std::istream& stream, Read<T>& array, bool is_compressed);
+  extern template void write_array(                                            \
+      std::ostream& stream, Read<T> array, Codec codec);                       \
+  extern template void read_array(std::istream& stream, Read<T>& array,        \
+      bool is_compressed, I32 version);
 INST_DECL(I8)
 INST_DECL(I32)
 INST_DECL(I64)
@@ -0,0 +1,101 @@
+#include "Omega_h_future.hpp"
+
+#include <utility>
+
+#include "Omega_h_profile.hpp"
+#include "Omega_h_timer.hpp"
+
+namespace Omega_h {
+
+#ifdef OMEGA_H_USE_MPI
+#define CALL(f) OMEGA_H_CHECK(MPI_SUCCESS == (f))
+#endif
+
+template <typename T>
+Future<T>::Future() {}
+
+template <typename T>
+Future<T>::Future(Read<T> result) : finisher_([result]() { return result; }) {}
+
+#ifdef OMEGA_H_USE_MPI
+template <typename T>
+Future<T>::Future(requests_type&& requests, finisher_type const& finisher)
+    : finisher_(finisher), requests_(std::move(requests)) {}
+#endif
+
+template <typename T>
+Future<T>::Future(Future&& other) {
+  *this = std::move(other);
+}
+
+template <typename T>
+Future<T>& Future<T>::operator=(Future&& other) {
+  wait();
+  finisher_ = std::move(other.finisher_);
+  other.finisher_ = finisher_type();
+#ifdef OMEGA_H_USE_MPI
+  requests_ = std::move(other.requests_);
+  other.requests_.clear();
+#endif
+  return *this;
+}
+
+template <typename T>
+Future<T>::~Future() {
+  wait();
+}
+
+template <typename T>
+void Future<T>::add_callback(callback_type const& callback) {
+  OMEGA_H_CHECK(bool(finisher_));
+  auto previous = finisher_;
+  finisher_ = [previous, callback]() { return callback(previous()); };
+}
+
+template <typename T>
+bool Future<T>::completed() {
+#ifdef OMEGA_H_USE_MPI
+  if (requests_.empty()) return true;
+  int flag;
+  CALL(MPI_Testall(int(requests_.size()), requests_.data(), &flag,
+      MPI_STATUSES_IGNORE));
+  if (flag) requests_.clear();
+  return bool(flag);
+#else
+  return true;
+#endif
+}
+
+template <typename T>
+void Future<T>::wait() {
+#ifdef OMEGA_H_USE_MPI
+  if (requests_.empty()) return;
+  auto t0 = now();
+  CALL(MPI_Waitall(
+      int(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE));
+  if (profile::global_singleton_history) {
+    profile::simple_add_wait(now() - t0);
+  }
+  requests_.clear();
+#endif
+}
+
+template <typename T>
+Read<T> Future<T>::get() {
+  OMEGA_H_CHECK(bool(finisher_));
+  wait();
+  auto result = finisher_();
+  finisher_ = finisher_type();
+  return result;
+}
+
+#undef CALL
+
+#define INST(T) template class Future<T>;
+INST(I8)
+INST(I32)
+INST(I64)
+INST(Real)
+#undef INST
+
+}  // end namespace Omega_h
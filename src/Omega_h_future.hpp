@@ -0,0 +1,61 @@
+#ifndef OMEGA_H_FUTURE_HPP
+#define OMEGA_H_FUTURE_HPP
+
+#include <functional>
+#include <vector>
+
+#include <Omega_h_array.hpp>
+
+namespace Omega_h {
+
+/* the result of a communication that may still be in flight.
+   get() waits for all its messages, runs the post-processing
+   attached by add_callback() in the order it was attached,
+   and returns the final array.
+   because it owns MPI requests and the buffers they point into,
+   a Future can be moved but not copied, and get() may only be
+   called once. destroying an unfinished Future waits for it. */
+
+template <typename T>
+class Future {
+ public:
+  typedef std::function<Read<T>()> finisher_type;
+  typedef std::function<Read<T>(Read<T>)> callback_type;
+#ifdef OMEGA_H_USE_MPI
+  typedef std::vector<MPI_Request> requests_type;
+#endif
+  Future();
+  /* an already completed Future */
+  explicit Future(Read<T> result);
+#ifdef OMEGA_H_USE_MPI
+  /* (finisher) is called once all (requests) are complete,
+     it should hold on to the buffers used by the requests */
+  Future(requests_type&& requests, finisher_type const& finisher);
+#endif
+  Future(Future&& other);
+  Future& operator=(Future&& other);
+  Future(Future const&) = delete;
+  Future& operator=(Future const&) = delete;
+  ~Future();
+  void add_callback(callback_type const& callback);
+  bool completed();
+  Read<T> get();
+
+ private:
+  void wait();
+  finisher_type finisher_;
+#ifdef OMEGA_H_USE_MPI
+  requests_type requests_;
+#endif
+};
+
+#define OMEGA_H_EXPL_INST_DECL(T) extern template class Future<T>;
+OMEGA_H_EXPL_INST_DECL(I8)
+OMEGA_H_EXPL_INST_DECL(I32)
+OMEGA_H_EXPL_INST_DECL(I64)
+OMEGA_H_EXPL_INST_DECL(Real)
+#undef OMEGA_H_EXPL_INST_DECL
+
+}  // end namespace Omega_h
+
+#endif
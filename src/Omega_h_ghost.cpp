@@ -1,9 +1,14 @@
 #include "Omega_h_ghost.hpp"
 
+#include <iostream>
+
+#include "Omega_h_array_ops.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_migrate.hpp"
+#include "Omega_h_simplex.hpp"
+#include "Omega_h_unmap_mesh.hpp"
 
 namespace Omega_h {
 
@@ -140,4 +145,64 @@ void partition_by_elems(Mesh* mesh, bool verbose) {
   migrate_mesh(mesh, dist, OMEGA_H_ELEM_BASED, verbose);
 }
 
+static GO count_tag_bytes(Mesh* mesh, Int ent_dim, LO nents) {
+  GO nbytes = 0;
+  for (Int i = 0; i < mesh->ntags(ent_dim); ++i) {
+    auto tag = mesh->get_tag(ent_dim, i);
+    GO nbytes_per_comp = 0;
+    if (is<I8>(tag)) nbytes_per_comp = sizeof(I8);
+    if (is<I32>(tag)) nbytes_per_comp = sizeof(I32);
+    if (is<I64>(tag)) nbytes_per_comp = sizeof(I64);
+    if (is<Real>(tag)) nbytes_per_comp = sizeof(Real);
+    nbytes += GO(nents) * tag->ncomps() * nbytes_per_comp;
+  }
+  return nbytes;
+}
+
+GO unghost_mesh(Mesh* mesh, bool verbose) {
+  begin_code("unghost_mesh");
+  auto comm = mesh->comm();
+  auto dim = mesh->dim();
+  auto owned_elems2elems = collect_marked(mesh->owned(dim));
+  LOs new_ents2old_ents[4];
+  LO nlost_owned = 0;
+  GO nbytes_kept = 0;
+  for (Int d = 0; d <= dim; ++d) {
+    /* unlike mark_down(), only look at the local closure */
+    auto kept = mesh->owned(dim);
+    if (d < dim) {
+      auto deg = simplex_degrees[dim][d];
+      auto elems2ents = mesh->ask_down(dim, d).ab2b;
+      auto owned_elems2ents = unmap(owned_elems2elems, elems2ents, deg);
+      kept = mark_image(owned_elems2ents, mesh->nents(d));
+    }
+    auto owned = mesh->owned(d);
+    nlost_owned += get_sum(owned) - get_sum(land_each(owned, kept));
+    new_ents2old_ents[d] = collect_marked(kept);
+    nbytes_kept += count_tag_bytes(mesh, d, new_ents2old_ents[d].size());
+  }
+  /* ghosting keeps the owner of every entity, so each owner
+     still has an owned element adjacent to it unless the mesh
+     was ghosted some other way */
+  if (comm->allreduce(GO(nlost_owned), OMEGA_H_SUM) > 0) {
+    end_code();
+    partition_by_elems(mesh, verbose);
+    return 0;
+  }
+  if (verbose) {
+    auto nelems = comm->allreduce(GO(mesh->nelems()), OMEGA_H_SUM);
+    auto nkept = comm->allreduce(
+        GO(new_ents2old_ents[dim].size()), OMEGA_H_SUM);
+    auto nbytes = comm->allreduce(nbytes_kept, OMEGA_H_SUM);
+    if (comm->rank() == 0) {
+      std::cout << "unghosting in place keeps (" << nkept << ") / ("
+                << nelems << " total) elements, (" << nbytes
+                << ") bytes of tag data not migrated\n";
+    }
+  }
+  unmap_mesh(mesh, new_ents2old_ents);
+  end_code();
+  return nbytes_kept;
+}
+
 }  // end namespace Omega_h
@@ -28,6 +28,17 @@ void ghost_mesh(Mesh* mesh, Int nlayers, bool verbose);
 void partition_by_verts(Mesh* mesh, bool verbose);
 void partition_by_elems(Mesh* mesh, bool verbose);
 
+/* goes from ghosted to element based partitioning without migration:
+   each rank drops its ghost elements and the entities adjacent only
+   to them.
+   ghosting never changes owners, so every entity stays with its
+   owner and only the owner indices need to be renumbered.
+   the result matches partition_by_elems() except that entities
+   on part boundaries keep the owner they had before ghosting.
+   returns how many bytes of tag data this rank did not migrate,
+   which is zero if it had to fall back to partition_by_elems() */
+GO unghost_mesh(Mesh* mesh, bool verbose);
+
 }  // end namespace Omega_h
 
 #endif
@@ -6,6 +6,7 @@
 #include <iostream>
 
 #include "Omega_h_array_ops.hpp"
+#include "Omega_h_lazy.hpp"
 #include "Omega_h_mark.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_simplex.hpp"
@@ -25,14 +26,18 @@ Histogram get_histogram(Mesh* mesh, Int dim, Int nbins, Real min_value,
     auto floor = interval * i + min_value;
     auto ceil = interval * (i + 1) + min_value;
     if (i == nbins - 1) ceil = max_value;
-    auto floor_marks = each_geq_to(owned_values, floor);
-    Read<I8> ceil_marks;
-    if (i == nbins - 1)
-      ceil_marks = each_leq_to(owned_values, ceil);
-    else
-      ceil_marks = each_lt(owned_values, ceil);
-    auto marked = land_each(floor_marks, ceil_marks);
-    histogram.bins[std::size_t(i)] = get_sum(mesh->comm(), marked);
+    auto floor_marks = lazy::each_geq_to(owned_values, floor);
+    GO count;
+    if (i == nbins - 1) {
+      auto ceil_marks = lazy::each_leq_to(owned_values, ceil);
+      count = lazy::get_sum(
+          mesh->comm(), lazy::land_each(floor_marks, ceil_marks));
+    } else {
+      auto ceil_marks = lazy::each_lt(owned_values, ceil);
+      count = lazy::get_sum(
+          mesh->comm(), lazy::land_each(floor_marks, ceil_marks));
+    }
+    histogram.bins[std::size_t(i)] = count;
   }
   return histogram;
 }
@@ -1,6 +1,7 @@
 #include "Omega_h_indset.hpp"
 
 #include "Omega_h_array_ops.hpp"
+#include "Omega_h_lazy.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_mesh.hpp"
 
@@ -62,7 +63,8 @@ GOs find_indset(Graph graph, Int distance, Bytes candidates, Reals qualities,
   parallel_for(n, setup, "find_indset(setup)");
   auto marks = Bytes(initial_marks);
   Write<GO> owner_globals(n, GO(-1));
-  while (get_sum(comm, each_eq_to(marks, I8(indset::UNKNOWN)))) {
+  while (lazy::get_sum(
+      comm, lazy::each_eq_to(marks, I8(indset::UNKNOWN)))) {
     indset::Tuples tuples = {marks, qualities, globals};
     for (Int r = 0; r < distance; ++r) {
       Write<I8> new_marks(n);
@@ -85,9 +87,14 @@ GOs find_indset(Graph graph, Int distance, Bytes candidates, Reals qualities,
       tuples.qualities = new_qualities;
       tuples.globals = new_globals;
       if (is_distributed) {
-        tuples.marks = owners2copies.exch(tuples.marks, 1);
-        tuples.qualities = owners2copies.exch(tuples.qualities, 1);
-        tuples.globals = owners2copies.exch(tuples.globals, 1);
+        DistBundle bundle;
+        bundle.add(tuples.marks, 1);
+        bundle.add(tuples.qualities, 1);
+        bundle.add(tuples.globals, 1);
+        bundle = owners2copies.exch(bundle);
+        tuples.marks = bundle.get<I8>(0);
+        tuples.qualities = bundle.get<Real>(1);
+        tuples.globals = bundle.get<GO>(2);
       }
     }
     Write<I8> new_marks(n);
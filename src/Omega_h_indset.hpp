@@ -9,6 +9,12 @@ namespace Omega_h {
 
 class Mesh;
 
+/* a maximal independent set of the (candidates) in (graph), preferring
+   higher (qualities). adapt() rebuilds the mesh once per set, with
+   (graph) linking the keys whose cavities share an element. since
+   every candidate left out is linked to one in the set, no other set
+   of keys could be applied by the same rebuild; they wait for the
+   next one with what the rebuild changed around them */
 GOs find_indset(Graph graph, Int distance, Bytes candidates, Reals qualities,
     GOs globals, Dist owners2copies);
 
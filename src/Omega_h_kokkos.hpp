@@ -2,6 +2,7 @@
 #define OMEGA_H_KOKKOS_HPP
 
 #include <Omega_h_c.h>
+#include <Omega_h_profile.hpp>
 #include <string>
 
 #ifdef OMEGA_H_USE_KOKKOSCORE
@@ -50,12 +51,12 @@ namespace Omega_h {
 inline void begin_code(std::string const& name) {
 #ifdef OMEGA_H_USE_KOKKOSCORE
   Kokkos::Profiling::pushRegion(name);
-#else
-  (void)name;
 #endif
+  if (profile::global_singleton_history) profile::simple_push(name);
 }
 
 inline void end_code() {
+  if (profile::global_singleton_history) profile::simple_pop();
 #ifdef OMEGA_H_USE_KOKKOSCORE
   Kokkos::Profiling::popRegion();
 #endif
@@ -4,12 +4,18 @@
 #include <iostream>
 
 #include "Omega_h_array_ops.hpp"
+#include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
 #include "Omega_h_mark.hpp"
 #include "Omega_h_mesh.hpp"
 
 namespace Omega_h {
 
+/* Jacobi iterations where each vertex becomes the average of
+   its neighbors and boundary vertices keep their initial values.
+   as in limit_metric_gradation(), shared vertices are updated first
+   and their exchange overlaps the update of the other vertices */
+
 Reals solve_laplacian(
     Mesh* mesh, Reals initial, Int width, Real tol, Real floor) {
   OMEGA_H_CHECK(mesh->owners_have_all_upward(VERT));
@@ -18,18 +24,44 @@ Reals solve_laplacian(
   auto state = initial;
   auto star = mesh->ask_star(VERT);
   auto interior = mark_by_class_dim(mesh, VERT, mesh->dim());
-  auto boundary = invert_marks(interior);
-  auto b2v = collect_marked(boundary);
-  auto weights = Reals(star.ab2b.size(), 1.0);
-  auto bc_data = unmap(b2v, initial, width);
+  auto shared = mark_shared(mesh, VERT);
+  auto shared_verts = collect_marked(shared);
+  auto unshared_verts = collect_marked(invert_marks(shared));
   bool done = false;
   Int niters = 0;
   do {
-    auto new_state_nobc = graph_weighted_average(star, weights, state, width);
-    auto new_state_w = deep_copy(new_state_nobc);
-    map_into(bc_data, b2v, new_state_w, width);
+    auto relax = OMEGA_H_LAMBDA(Write<Real> const& out, LO v) {
+      if (!interior[v]) {
+        for (Int j = 0; j < width; ++j) {
+          out[v * width + j] = initial[v * width + j];
+        }
+        return;
+      }
+      auto begin = star.a2ab[v];
+      auto end = star.a2ab[v + 1];
+      for (Int j = 0; j < width; ++j) {
+        Real sum = 0.0;
+        for (auto vv = begin; vv < end; ++vv) {
+          sum += state[star.ab2b[vv] * width + j];
+        }
+        out[v * width + j] = sum / (end - begin);
+      }
+    };
+    auto shared_state = Write<Real>(mesh->nverts() * width);
+    auto f_shared = OMEGA_H_LAMBDA(LO sv) {
+      relax(shared_state, shared_verts[sv]);
+    };
+    parallel_for(shared_verts.size(), f_shared, "solve_laplacian(shared)");
+    auto future = mesh->sync_array_begin(VERT, Reals(shared_state), width);
+    auto new_state_w = Write<Real>(mesh->nverts() * width);
+    auto f_unshared = OMEGA_H_LAMBDA(LO uv) {
+      relax(new_state_w, unshared_verts[uv]);
+    };
+    parallel_for(unshared_verts.size(), f_unshared, "solve_laplacian");
+    auto synced = mesh->sync_array_end(future);
+    map_into(unmap(shared_verts, synced, width), shared_verts, new_state_w,
+        width);
     auto new_state = Reals(new_state_w);
-    new_state = mesh->sync_array(VERT, new_state, width);
     auto local_done = are_close(state, new_state, tol, floor);
     done = comm->reduce_and(local_done);
     state = new_state;
@@ -0,0 +1,334 @@
+#ifndef OMEGA_H_LAZY_HPP
+#define OMEGA_H_LAZY_HPP
+
+#include <Omega_h_array_ops.hpp>
+#include <Omega_h_loop.hpp>
+
+namespace Omega_h {
+
+/* lazy, fused counterparts of the elementwise functions
+   in Omega_h_array_ops.hpp.
+   instead of writing a temporary array, each lazy::each_*
+   function returns a small expression object which can be
+   composed further and is only evaluated per-entry by the single
+   parallel_for (lazy::evaluate) or parallel_reduce (lazy::get_sum,
+   lazy::get_min, lazy::get_max, lazy::get_minmax) at the end.
+   for example,
+     lazy::get_sum(comm, lazy::each_eq_to(marks, I8(1)))
+   counts marks without allocating the Bytes array of each_eq_to.
+   arguments may be Read arrays or other lazy expressions. */
+
+namespace lazy {
+
+template <typename T>
+struct Array {
+  typedef T value_type;
+  Read<T> a_;
+  Array(Read<T> a) : a_(a) {}
+  LO size() const { return a_.size(); }
+  OMEGA_H_DEVICE T operator()(LO i) const { return a_[i]; }
+};
+
+/* converts arguments (arrays or expressions) into expressions */
+template <typename E>
+struct AsExpr {
+  typedef E type;
+  static E get(E e) { return e; }
+};
+
+template <typename T>
+struct AsExpr<Read<T>> {
+  typedef Array<T> type;
+  static type get(Read<T> a) { return type(a); }
+};
+
+template <>
+struct AsExpr<Bytes> : public AsExpr<Read<I8>> {};
+template <>
+struct AsExpr<LOs> : public AsExpr<Read<LO>> {};
+template <>
+struct AsExpr<GOs> : public AsExpr<Read<GO>> {};
+template <>
+struct AsExpr<Reals> : public AsExpr<Read<Real>> {};
+
+template <typename E>
+typename AsExpr<E>::type as_expr(E e) {
+  return AsExpr<E>::get(e);
+}
+
+template <typename Op, typename A>
+struct UnaryExpr {
+  typedef typename Op::template Result<typename A::value_type>::type value_type;
+  A a_;
+  UnaryExpr(A a) : a_(a) {}
+  LO size() const { return a_.size(); }
+  OMEGA_H_DEVICE value_type operator()(LO i) const { return Op::apply(a_(i)); }
+};
+
+/* an expression combined entrywise with a constant */
+template <typename Op, typename A, typename T>
+struct ScalarExpr {
+  typedef typename Op::template Result<typename A::value_type>::type value_type;
+  A a_;
+  T b_;
+  ScalarExpr(A a, T b) : a_(a), b_(b) {}
+  LO size() const { return a_.size(); }
+  OMEGA_H_DEVICE value_type operator()(LO i) const {
+    return Op::apply(a_(i), b_);
+  }
+};
+
+template <typename Op, typename A, typename B>
+struct BinaryExpr {
+  typedef typename Op::template Result<typename A::value_type>::type value_type;
+  A a_;
+  B b_;
+  BinaryExpr(A a, B b) : a_(a), b_(b) {
+    OMEGA_H_CHECK(a_.size() == b_.size());
+  }
+  LO size() const { return a_.size(); }
+  OMEGA_H_DEVICE value_type operator()(LO i) const {
+    return Op::apply(a_(i), b_(i));
+  }
+};
+
+struct Arithmetic {
+  template <typename T>
+  struct Result {
+    typedef T type;
+  };
+};
+
+struct Logical {
+  template <typename T>
+  struct Result {
+    typedef I8 type;
+  };
+};
+
+#define OMEGA_H_LAZY_OP(Name, Kind, expr)                                      \
+  struct Name : public Kind {                                                  \
+    template <typename T, typename U>                                          \
+    static OMEGA_H_INLINE typename Kind::template Result<T>::type apply(       \
+        T a, U b) {                                                            \
+      return static_cast<typename Kind::template Result<T>::type>(expr);       \
+    }                                                                          \
+  };
+OMEGA_H_LAZY_OP(Add, Arithmetic, a + b)
+OMEGA_H_LAZY_OP(Subtract, Arithmetic, a - b)
+OMEGA_H_LAZY_OP(Multiply, Arithmetic, a * b)
+OMEGA_H_LAZY_OP(Divide, Arithmetic, a / b)
+OMEGA_H_LAZY_OP(Min, Arithmetic, min2(a, static_cast<T>(b)))
+OMEGA_H_LAZY_OP(Max, Arithmetic, max2(a, static_cast<T>(b)))
+OMEGA_H_LAZY_OP(Eq, Logical, a == b)
+OMEGA_H_LAZY_OP(Neq, Logical, a != b)
+OMEGA_H_LAZY_OP(Lt, Logical, a < b)
+OMEGA_H_LAZY_OP(Gt, Logical, a > b)
+OMEGA_H_LAZY_OP(Leq, Logical, a <= b)
+OMEGA_H_LAZY_OP(Geq, Logical, a >= b)
+OMEGA_H_LAZY_OP(And, Logical, a && b)
+OMEGA_H_LAZY_OP(Or, Logical, a || b)
+#undef OMEGA_H_LAZY_OP
+
+struct Fabs : public Arithmetic {
+  template <typename T>
+  static OMEGA_H_INLINE T apply(T a) {
+    return (a < 0) ? -a : a;
+  }
+};
+
+struct Not : public Logical {
+  template <typename T>
+  static OMEGA_H_INLINE I8 apply(T a) {
+    return static_cast<I8>(!a);
+  }
+};
+
+#define OMEGA_H_LAZY_SCALAR_FUNC(name, Op)                                     \
+  template <typename A, typename T>                                            \
+  ScalarExpr<Op, typename AsExpr<A>::type, T> name(A a, T b) {                 \
+    return ScalarExpr<Op, typename AsExpr<A>::type, T>(as_expr(a), b);         \
+  }
+OMEGA_H_LAZY_SCALAR_FUNC(add_to_each, Add)
+OMEGA_H_LAZY_SCALAR_FUNC(subtract_from_each, Subtract)
+OMEGA_H_LAZY_SCALAR_FUNC(multiply_each_by, Multiply)
+OMEGA_H_LAZY_SCALAR_FUNC(divide_each_by, Divide)
+OMEGA_H_LAZY_SCALAR_FUNC(each_max_with, Max)
+OMEGA_H_LAZY_SCALAR_FUNC(each_eq_to, Eq)
+OMEGA_H_LAZY_SCALAR_FUNC(each_neq_to, Neq)
+OMEGA_H_LAZY_SCALAR_FUNC(each_lt, Lt)
+OMEGA_H_LAZY_SCALAR_FUNC(each_gt, Gt)
+OMEGA_H_LAZY_SCALAR_FUNC(each_leq_to, Leq)
+OMEGA_H_LAZY_SCALAR_FUNC(each_geq_to, Geq)
+#undef OMEGA_H_LAZY_SCALAR_FUNC
+
+#define OMEGA_H_LAZY_BINARY_FUNC(name, Op)                                     \
+  template <typename A, typename B>                                            \
+  BinaryExpr<Op, typename AsExpr<A>::type, typename AsExpr<B>::type> name(     \
+      A a, B b) {                                                              \
+    return BinaryExpr<Op, typename AsExpr<A>::type, typename AsExpr<B>::type>( \
+        as_expr(a), as_expr(b));                                               \
+  }
+OMEGA_H_LAZY_BINARY_FUNC(add_each, Add)
+OMEGA_H_LAZY_BINARY_FUNC(subtract_each, Subtract)
+OMEGA_H_LAZY_BINARY_FUNC(min_each, Min)
+OMEGA_H_LAZY_BINARY_FUNC(max_each, Max)
+OMEGA_H_LAZY_BINARY_FUNC(eq_each, Eq)
+OMEGA_H_LAZY_BINARY_FUNC(gt_each, Gt)
+OMEGA_H_LAZY_BINARY_FUNC(lt_each, Lt)
+OMEGA_H_LAZY_BINARY_FUNC(land_each, And)
+OMEGA_H_LAZY_BINARY_FUNC(lor_each, Or)
+#undef OMEGA_H_LAZY_BINARY_FUNC
+
+/* unlike Omega_h::multiply_each and divide_each,
+   these require both operands to have the same size */
+template <typename A, typename B>
+BinaryExpr<Multiply, typename AsExpr<A>::type, typename AsExpr<B>::type>
+multiply_each(A a, B b) {
+  return BinaryExpr<Multiply, typename AsExpr<A>::type,
+      typename AsExpr<B>::type>(as_expr(a), as_expr(b));
+}
+
+template <typename A, typename B>
+BinaryExpr<Divide, typename AsExpr<A>::type, typename AsExpr<B>::type>
+divide_each(A a, B b) {
+  return BinaryExpr<Divide, typename AsExpr<A>::type,
+      typename AsExpr<B>::type>(as_expr(a), as_expr(b));
+}
+
+template <typename A>
+UnaryExpr<Fabs, typename AsExpr<A>::type> fabs_each(A a) {
+  return UnaryExpr<Fabs, typename AsExpr<A>::type>(as_expr(a));
+}
+
+template <typename A>
+UnaryExpr<Not, typename AsExpr<A>::type> lnot_each(A a) {
+  return UnaryExpr<Not, typename AsExpr<A>::type>(as_expr(a));
+}
+
+/* writes the values of an expression to a new array
+   in a single parallel_for */
+template <typename A>
+Read<typename AsExpr<A>::type::value_type> evaluate(
+    A a, std::string const& name = "lazy::evaluate") {
+  auto e = as_expr(a);
+  typedef typename AsExpr<A>::type::value_type T;
+  Write<T> out(e.size());
+  auto f = OMEGA_H_LAMBDA(LO i) { out[i] = e(i); };
+  parallel_for(out.size(), f, name);
+  return out;
+}
+
+template <typename E>
+struct SumExpr : public SumFunctor<typename E::value_type> {
+  using typename SumFunctor<typename E::value_type>::value_type;
+  E e_;
+  SumExpr(E e) : e_(e) {}
+  OMEGA_H_DEVICE void operator()(LO i, value_type& update) const {
+    update = update + e_(i);
+  }
+};
+
+template <typename E>
+struct MinExpr : public MinFunctor<typename E::value_type> {
+  using typename MinFunctor<typename E::value_type>::value_type;
+  E e_;
+  MinExpr(E e) : e_(e) {}
+  OMEGA_H_DEVICE void operator()(LO i, value_type& update) const {
+    update = min2<value_type>(update, e_(i));
+  }
+};
+
+template <typename E>
+struct MaxExpr : public MaxFunctor<typename E::value_type> {
+  using typename MaxFunctor<typename E::value_type>::value_type;
+  E e_;
+  MaxExpr(E e) : e_(e) {}
+  OMEGA_H_DEVICE void operator()(LO i, value_type& update) const {
+    update = max2<value_type>(update, e_(i));
+  }
+};
+
+template <typename E>
+struct MinMaxExpr {
+  typedef typename StandinTraits<typename E::value_type>::type S;
+  typedef MinMax<S> value_type;
+  E e_;
+  MinMaxExpr(E e) : e_(e) {}
+  OMEGA_H_INLINE void init(value_type& update) const {
+    update.min = ArithTraits<typename E::value_type>::max();
+    update.max = ArithTraits<typename E::value_type>::min();
+  }
+  OMEGA_H_INLINE void join(
+      volatile value_type& update, const volatile value_type& input) const {
+    update.min = min2<S>(update.min, input.min);
+    update.max = max2<S>(update.max, input.max);
+  }
+  OMEGA_H_DEVICE void operator()(LO i, value_type& update) const {
+    auto x = static_cast<S>(e_(i));
+    update.min = min2(update.min, x);
+    update.max = max2(update.max, x);
+  }
+};
+
+template <typename A>
+typename StandinTraits<typename AsExpr<A>::type::value_type>::type get_sum(
+    A a) {
+  auto e = as_expr(a);
+  return parallel_reduce(
+      e.size(), SumExpr<decltype(e)>(e), "lazy::get_sum");
+}
+
+template <typename A>
+typename AsExpr<A>::type::value_type get_min(A a) {
+  auto e = as_expr(a);
+  typedef typename decltype(e)::value_type T;
+  return static_cast<T>(
+      parallel_reduce(e.size(), MinExpr<decltype(e)>(e), "lazy::get_min"));
+}
+
+template <typename A>
+typename AsExpr<A>::type::value_type get_max(A a) {
+  auto e = as_expr(a);
+  typedef typename decltype(e)::value_type T;
+  return static_cast<T>(
+      parallel_reduce(e.size(), MaxExpr<decltype(e)>(e), "lazy::get_max"));
+}
+
+template <typename A>
+MinMax<typename AsExpr<A>::type::value_type> get_minmax(A a) {
+  auto e = as_expr(a);
+  typedef typename decltype(e)::value_type T;
+  auto r = parallel_reduce(
+      e.size(), MinMaxExpr<decltype(e)>(e), "lazy::get_minmax");
+  return {static_cast<T>(r.min), static_cast<T>(r.max)};
+}
+
+template <typename A>
+typename StandinTraits<typename AsExpr<A>::type::value_type>::type get_sum(
+    CommPtr comm, A a) {
+  return comm->allreduce(lazy::get_sum(a), OMEGA_H_SUM);
+}
+
+template <typename A>
+typename AsExpr<A>::type::value_type get_min(CommPtr comm, A a) {
+  return comm->allreduce(lazy::get_min(a), OMEGA_H_MIN);
+}
+
+template <typename A>
+typename AsExpr<A>::type::value_type get_max(CommPtr comm, A a) {
+  return comm->allreduce(lazy::get_max(a), OMEGA_H_MAX);
+}
+
+template <typename A>
+MinMax<typename AsExpr<A>::type::value_type> get_minmax(CommPtr comm, A a) {
+  auto r = lazy::get_minmax(a);
+  return {comm->allreduce(r.min, OMEGA_H_MIN),
+      comm->allreduce(r.max, OMEGA_H_MAX)};
+}
+
+}  // end namespace lazy
+
+}  // end namespace Omega_h
+
+#endif
@@ -7,6 +7,8 @@
 
 namespace Omega_h {
 
+class Pool;
+
 class Library {
  public:
   Library(Library const&);
@@ -30,6 +32,11 @@ class Library {
   CommPtr self();
   void add_to_timer(std::string const& name, double nsecs);
   LO self_send_threshold() const;
+#ifdef OMEGA_H_USE_MPI
+  NodeWindow* node_window() const;
+#endif
+  /* the caching pool for array memory, empty unless --osh-pool */
+  std::shared_ptr<Pool> pool() const;
   bool should_time_;
   LO self_send_threshold_;
   bool silent_;
@@ -43,13 +50,16 @@ class Library {
       );
   CommPtr world_;
   CommPtr self_;
+  std::shared_ptr<Pool> pool_;
 #ifdef OMEGA_H_USE_MPI
+  std::shared_ptr<NodeWindow> node_window_;
   bool we_called_mpi_init;
 #endif
 #ifdef OMEGA_H_USE_KOKKOSCORE
   bool we_called_kokkos_init;
 #endif
   std::map<std::string, double> timers;
+  std::string time_json_path_;
 };
 
 }  // namespace Omega_h
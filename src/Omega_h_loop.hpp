@@ -4,6 +4,11 @@
 #include <Omega_h_defines.hpp>
 #include <Omega_h_kokkos.hpp>
 
+#if defined(OMEGA_H_USE_OPENMP) && !defined(OMEGA_H_USE_KOKKOSCORE)
+#include <omp.h>
+#include <vector>
+#endif
+
 namespace Omega_h {
 
 #ifdef OMEGA_H_USE_KOKKOSCORE
@@ -12,12 +17,37 @@ using StaticSched = Kokkos::Schedule<Kokkos::Static>;
 using Policy = Kokkos::RangePolicy<ExecSpace, StaticSched>;
 
 inline Policy policy(LO n) { return Policy(0, static_cast<std::size_t>(n)); }
+#elif defined(OMEGA_H_USE_OPENMP)
+/* the native OpenMP backend splits [0,n) into one contiguous
+   block per thread, in thread order, so that reductions and
+   scans can combine per-thread partial values deterministically
+   for a given thread count */
+inline LO thread_block_begin(LO n, int thread, int nthreads) {
+  return static_cast<LO>((I64(n) * thread) / nthreads);
+}
+
+/* joins per-thread partial values pairwise, preserving the
+   left-to-right order of the blocks */
+template <typename T>
+void tree_join(T const& f, std::vector<typename T::value_type>& partials,
+    int nparts) {
+  for (int stride = 1; stride < nparts; stride *= 2) {
+    for (int i = 0; i + stride < nparts; i += 2 * stride) {
+      f.join(partials[std::size_t(i)], partials[std::size_t(i + stride)]);
+    }
+  }
+}
 #endif
 
 template <typename T>
 void parallel_for(LO n, T const& f, std::string const& name = "") {
 #ifdef OMEGA_H_USE_KOKKOSCORE
   if (n > 0) Kokkos::parallel_for(policy(n), f, name);
+#elif defined(OMEGA_H_USE_OPENMP)
+  begin_code(name);
+#pragma omp parallel for schedule(static)
+  for (LO i = 0; i < n; ++i) f(i);
+  end_code();
 #else
   begin_code(name);
   for (LO i = 0; i < n; ++i) f(i);
@@ -33,6 +63,27 @@ typename T::value_type parallel_reduce(
   f.init(result);
 #ifdef OMEGA_H_USE_KOKKOSCORE
   if (n > 0) Kokkos::parallel_reduce(name, policy(n), f, result);
+#elif defined(OMEGA_H_USE_OPENMP)
+  begin_code(name);
+  auto max_threads = static_cast<std::size_t>(omp_get_max_threads());
+  std::vector<VT> partials(max_threads);
+  int nparts = 1;
+#pragma omp parallel
+  {
+    int nthreads = omp_get_num_threads();
+    int thread = omp_get_thread_num();
+#pragma omp single
+    nparts = nthreads;
+    VT& update = partials[std::size_t(thread)];
+    f.init(update);
+    auto end = thread_block_begin(n, thread + 1, nthreads);
+    for (auto i = thread_block_begin(n, thread, nthreads); i < end; ++i) {
+      f(i, update);
+    }
+  }
+  tree_join(f, partials, nparts);
+  f.join(result, partials[0]);
+  end_code();
 #else
   begin_code(name);
   for (LO i = 0; i < n; ++i) f(i, result);
@@ -45,6 +96,31 @@ template <typename T>
 void parallel_scan(LO n, T f, std::string const& name = "") {
 #ifdef OMEGA_H_USE_KOKKOSCORE
   if (n > 0) Kokkos::parallel_scan(policy(n), f, name);
+#elif defined(OMEGA_H_USE_OPENMP)
+  /* two-pass blocked scan: each thread first reduces its block,
+     then the block totals are exclusively scanned in thread order,
+     and finally each thread re-runs its block with final_pass=true
+     starting from the total of all blocks to its left. */
+  typedef typename T::value_type VT;
+  begin_code(name);
+  auto max_threads = static_cast<std::size_t>(omp_get_max_threads());
+  std::vector<VT> partials(max_threads);
+#pragma omp parallel
+  {
+    int nthreads = omp_get_num_threads();
+    int thread = omp_get_thread_num();
+    auto begin = thread_block_begin(n, thread, nthreads);
+    auto end = thread_block_begin(n, thread + 1, nthreads);
+    VT update;
+    f.init(update);
+    for (auto i = begin; i < end; ++i) f(i, update, false);
+    partials[std::size_t(thread)] = update;
+#pragma omp barrier
+    f.init(update);
+    for (int t = 0; t < thread; ++t) f.join(update, partials[std::size_t(t)]);
+    for (auto i = begin; i < end; ++i) f(i, update, true);
+  }
+  end_code();
 #else
   typedef typename T::value_type VT;
   begin_code(name);
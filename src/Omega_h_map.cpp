@@ -55,6 +55,20 @@ Read<T> unmap(LOs a2b, Read<T> b_data, Int width) {
   return a_data;
 }
 
+template <typename T>
+void remap_into(Read<T> a_data, LOs c2a, LOs c2b, Write<T> b_data, Int width) {
+  auto nc = c2a.size();
+  OMEGA_H_CHECK(c2b.size() == nc);
+  auto f = OMEGA_H_LAMBDA(LO c) {
+    auto a = c2a[c];
+    auto b = c2b[c];
+    for (Int j = 0; j < width; ++j) {
+      b_data[b * width + j] = a_data[a * width + j];
+    }
+  };
+  parallel_for(nc, f, "remap_into");
+}
+
 template <typename T>
 Read<T> expand(Read<T> a_data, LOs a2b, Int width) {
   auto na = a2b.size() - 1;
@@ -254,6 +268,8 @@ Read<T> fan_reduce(LOs a2b, Read<T> b_data, Int width, Omega_h_Op op) {
   template void map_into(Read<T> a_data, LOs a2b, Write<T> b_data, Int width); \
   template Read<T> map_onto(Read<T> a_data, LOs a2b, LO nb, T, Int width);     \
   template Read<T> unmap(LOs a2b, Read<T> b_data, Int width);                  \
+  template void remap_into(                                                    \
+      Read<T> a_data, LOs c2a, LOs c2b, Write<T> b_data, Int width);           \
   template Read<T> expand(Read<T> a_data, LOs a2b, Int width);                 \
   template Read<T> permute(Read<T> a_data, LOs a2b, Int width);                \
   template Read<T> fan_reduce(                                                 \
@@ -18,6 +18,11 @@ Read<T> map_onto(Read<T> a_data, LOs a2b, LO nb, T init_val, Int width);
 template <typename T>
 Read<T> unmap(LOs a2b, Read<T> b_data, Int width);
 
+/* same as map_into(unmap(c2a, a_data, width), c2b, b_data, width),
+   without the intermediate array */
+template <typename T>
+void remap_into(Read<T> a_data, LOs c2a, LOs c2b, Write<T> b_data, Int width);
+
 template <typename T>
 Read<T> expand(Read<T> a_data, LOs a2b, Int width);
 
@@ -66,6 +71,8 @@ Read<T> fan_reduce(LOs a2b, Read<T> b_data, Int width, Omega_h_Op op);
   extern template Read<T> map_onto(                                            \
       Read<T> a_data, LOs a2b, LO nb, T, Int width);                           \
   extern template Read<T> unmap(LOs a2b, Read<T> b_data, Int width);           \
+  extern template void remap_into(                                             \
+      Read<T> a_data, LOs c2a, LOs c2b, Write<T> b_data, Int width);           \
   extern template Read<T> expand(Read<T> a_data, LOs a2b, Int width);          \
   extern template Read<T> fan_reduce(                                          \
       LOs a2b, Read<T> b_data, Int width, Omega_h_Op op);
@@ -4,8 +4,11 @@
 
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_loop.hpp"
+#include "Omega_h_map.hpp"
 #include "Omega_h_mesh.hpp"
+#include "Omega_h_scan.hpp"
 #include "Omega_h_simplex.hpp"
+#include "Omega_h_sort.hpp"
 
 namespace Omega_h {
 
@@ -157,6 +160,23 @@ Read<I8> mark_dual_layers(Mesh* mesh, Read<I8> marks, Int nlayers) {
   return marks;
 }
 
+/* an entity is shared if it is not owned or if its owner
+   has copies on other ranks, i.e. if sync_array() may need
+   messages to update it.
+   an owner's copies include itself, so an owned entity is
+   shared unless it has exactly one copy */
+Read<I8> mark_shared(Mesh* mesh, Int ent_dim) {
+  auto nents = mesh->nents(ent_dim);
+  if (!mesh->could_be_shared(ent_dim)) return Read<I8>(nents, I8(0));
+  auto owners2copies = mesh->ask_dist(ent_dim).invert().roots2items();
+  Write<I8> shared(nents);
+  auto f = OMEGA_H_LAMBDA(LO e) {
+    shared[e] = I8((owners2copies[e + 1] - owners2copies[e]) != 1);
+  };
+  parallel_for(nents, f, "mark_shared");
+  return shared;
+}
+
 GO count_owned_marks(Mesh* mesh, Int ent_dim, Read<I8> marks) {
   if (mesh->could_be_shared(ent_dim)) {
     marks = land_each(marks, mesh->owned(ent_dim));
@@ -171,4 +191,97 @@ Read<I8> mark_sliver_layers(Mesh* mesh, Real qual_ceil, Int nlayers) {
   return mark_dual_layers(mesh, elems_are_slivers, nlayers);
 }
 
+/* each of (a2e) once, in increasing order */
+static LOs unique_ents(LOs a2e) {
+  auto sorted2a = sort_by_keys(a2e);
+  auto sorted = unmap(sorted2a, a2e, 1);
+  Write<I8> first(sorted.size());
+  auto f = OMEGA_H_LAMBDA(LO i) {
+    first[i] = I8(i == 0 || sorted[i] != sorted[i - 1]);
+  };
+  parallel_for(sorted.size(), f, "unique_ents");
+  return unmap(collect_marked(first), sorted, 1);
+}
+
+/* the (to_dim) entities adjacent to any of (froms), visiting
+   only the adjacencies of (froms) */
+static LOs collect_adj(Mesh* mesh, Int from_dim, Int to_dim, LOs froms) {
+  if (from_dim == to_dim) return froms;
+  if (from_dim > to_dim) {
+    auto deg = simplex_degrees[from_dim][to_dim];
+    auto fromtos2tos = mesh->ask_down(from_dim, to_dim).ab2b;
+    return unique_ents(unmap(froms, fromtos2tos, deg));
+  }
+  auto up = mesh->ask_up(from_dim, to_dim);
+  auto a2ab = up.a2ab;
+  auto ab2b = up.ab2b;
+  Write<LO> degrees(froms.size());
+  auto f = OMEGA_H_LAMBDA(LO i) {
+    degrees[i] = a2ab[froms[i] + 1] - a2ab[froms[i]];
+  };
+  parallel_for(froms.size(), f, "collect_adj(degrees)");
+  auto offsets = offset_scan(LOs(degrees));
+  Write<LO> tos(offsets.last());
+  auto g = OMEGA_H_LAMBDA(LO i) {
+    auto ab = a2ab[froms[i]];
+    for (auto j = offsets[i]; j < offsets[i + 1]; ++j) tos[j] = ab2b[ab++];
+  };
+  parallel_for(froms.size(), g, "collect_adj");
+  return unique_ents(tos);
+}
+
+/* the local vertices with (bit) set, the only full pass over
+   the "dirty" tag that collect_dirty() and clean_dirty() make */
+static LOs collect_dirty_verts(Mesh* mesh, I8 bit) {
+  auto dirty = mesh->get_array<I8>(VERT, "dirty");
+  Write<I8> verts_are_dirty(mesh->nverts());
+  auto f = OMEGA_H_LAMBDA(LO v) {
+    verts_are_dirty[v] = I8((dirty[v] & bit) != 0);
+  };
+  parallel_for(mesh->nverts(), f, "collect_dirty_verts");
+  return collect_marked(verts_are_dirty);
+}
+
+/* each rank only sets the bits of its own copies of the vertices
+   of elements it changed, so all copies of a vertex are given the
+   union of their marks */
+static LOs share_dirty_verts(Mesh* mesh, LOs verts) {
+  if (!mesh->could_be_shared(VERT)) return verts;
+  auto marks = mark_image(verts, mesh->nverts());
+  marks = mesh->reduce_array(VERT, marks, 1, OMEGA_H_MAX);
+  marks = mesh->sync_array(VERT, marks, 1);
+  return collect_marked(marks);
+}
+
+LOs collect_dirty(Mesh* mesh, Int ent_dim, I8 bit, Int nlayers) {
+  if (!mesh->has_tag(VERT, "dirty")) {
+    return LOs(mesh->nents(ent_dim), 0, 1);
+  }
+  auto verts = share_dirty_verts(mesh, collect_dirty_verts(mesh, bit));
+  for (Int i = 0; i < nlayers; ++i) {
+    auto elems = collect_adj(mesh, VERT, mesh->dim(), verts);
+    verts = share_dirty_verts(
+        mesh, collect_adj(mesh, mesh->dim(), VERT, elems));
+  }
+  return collect_adj(mesh, VERT, ent_dim, verts);
+}
+
+Read<I8> mark_dirty(Mesh* mesh, Int ent_dim, I8 bit, Int nlayers) {
+  auto ents = collect_dirty(mesh, ent_dim, bit, nlayers);
+  return mark_image(ents, mesh->nents(ent_dim));
+}
+
+void clean_dirty(Mesh* mesh, I8 bit) {
+  if (!mesh->has_tag(VERT, "dirty")) return;
+  auto verts = collect_dirty_verts(mesh, bit);
+  if (verts.size() == 0) return;
+  auto clean = deep_copy(mesh->get_array<I8>(VERT, "dirty"));
+  auto f = OMEGA_H_LAMBDA(LO i) {
+    auto v = verts[i];
+    clean[v] = I8(clean[v] & ~bit);
+  };
+  parallel_for(verts.size(), f, "clean_dirty");
+  mesh->set_tag(VERT, "dirty", Read<I8>(clean), true);
+}
+
 }  // end namespace Omega_h
@@ -19,8 +19,31 @@ Read<I8> mark_by_class_dim(Mesh* mesh, Int ent_dim, Int class_dim);
 Read<I8> mark_by_class(Mesh* mesh, Int ent_dim, Int class_dim, LO class_id);
 Read<I8> mark_by_owner(Mesh* mesh, Int ent_dim, I32 rank);
 Read<I8> mark_dual_layers(Mesh* mesh, Read<I8> marks, Int nlayers);
+Read<I8> mark_shared(Mesh* mesh, Int ent_dim);
 GO count_owned_marks(Mesh* mesh, Int ent_dim, Read<I8> marks);
 Read<I8> mark_sliver_layers(Mesh* mesh, Real qual_ceil, Int nlayers);
+
+/* bits of the vertex tag "dirty" that adapt() keeps while it runs.
+   modify_ents() sets all of them on the vertices of new elements,
+   and each operation clears its own bit once it has looked at
+   every candidate */
+enum {
+  REFINE_DIRTY = 1,
+  COARSEN_DIRTY = 2,
+  SWAP_DIRTY = 4,
+  SLIVER_DIRTY = 8,
+  ALL_DIRTY = 15
+};
+
+/* lists, in increasing order, the entities within (nlayers) element
+   layers of a vertex with (bit) set on any of its copies, or all
+   entities if there is no "dirty" tag.
+   past finding those vertices, the work and (in serial) the memory
+   are proportional to the entities near them */
+LOs collect_dirty(Mesh* mesh, Int ent_dim, I8 bit, Int nlayers);
+/* marks the entities that collect_dirty() lists */
+Read<I8> mark_dirty(Mesh* mesh, Int ent_dim, I8 bit, Int nlayers);
+void clean_dirty(Mesh* mesh, I8 bit);
 Read<I8> mark_exposed_sides(Mesh* mesh);
 Read<I8> mark_class_closure(
     Mesh* mesh, Int ent_dim, Int class_dim, LO class_id);
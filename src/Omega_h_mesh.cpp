@@ -8,12 +8,14 @@
 #include "Omega_h_bcast.hpp"
 #include "Omega_h_compare.hpp"
 #include "Omega_h_control.hpp"
+#include "Omega_h_diffuse.hpp"
 #include "Omega_h_ghost.hpp"
 #include "Omega_h_inertia.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
 #include "Omega_h_mark.hpp"
 #include "Omega_h_migrate.hpp"
+#include "Omega_h_multilevel.hpp"
 #include "Omega_h_quality.hpp"
 #include "Omega_h_shape.hpp"
 #include "Omega_h_simplex.hpp"
@@ -26,6 +28,7 @@ Mesh::Mesh(Library* library_in) {
   for (Int i = 0; i <= 3; ++i) nents_[i] = -1;
   parting_ = -1;
   nghost_layers_ = -1;
+  nunmigrated_bytes_ = 0;
   OMEGA_H_CHECK(library_in != nullptr);
   library_ = library_in;
 }
@@ -54,13 +57,15 @@ void Mesh::set_comm(CommPtr const& new_comm) {
   /* if some ranks already have mesh data, their
      parallel info needs updating, we'll do this
      by using the old Dist to set new owners */
-  if (0 < nnew_had_comm && library_->world()->size() > 1) {
+  if (0 < nnew_had_comm &&
+      (library_->world()->size() > 1 || new_comm->size() > 1)) {
     for (Int d = 0; d <= dim(); ++d) {
       auto dist = ask_dist(d);
       dist.change_comm(new_comm);
       owners_[d].ranks = dist.items2ranks();
     }
   }
+  for (Int d = 0; d <= 3; ++d) sync_plans_[d].clear();
   comm_ = new_comm;
 }
 
@@ -147,11 +152,21 @@ void Mesh::set_tag(
   tag->set_array(array);
 }
 
+template <typename T>
+void Mesh::add_lazy_tag(Int ent_dim, std::string const& name, Int ncomps,
+    std::function<Read<T>()> loader) {
+  add_tag<T>(ent_dim, name, ncomps);
+  as<T>(tag_iter(ent_dim, name)->get())->set_loader(loader);
+}
+
 void Mesh::react_to_set_tag(Int ent_dim, std::string const& name) {
   /* hardcoded cache invalidations */
   if ((ent_dim == VERT) && ((name == "coordinates") || (name == "metric"))) {
     remove_tag(EDGE, "length");
     remove_tag(dim(), "quality");
+    if (has_tag(VERT, "dirty")) {
+      set_tag(VERT, "dirty", Read<I8>(nverts(), I8(ALL_DIRTY)), true);
+    }
   }
   if ((ent_dim == VERT) && (name == "coordinates")) {
     remove_tag(dim(), "size");
@@ -388,6 +403,7 @@ void Mesh::set_owners(Int ent_dim, Remotes owners) {
   OMEGA_H_CHECK(nents(ent_dim) == owners.idxs.size());
   owners_[ent_dim] = owners;
   dists_[ent_dim] = DistPtr();
+  sync_plans_[ent_dim].clear();
 }
 
 Remotes Mesh::ask_owners(Int ent_dim) {
@@ -414,6 +430,14 @@ Dist Mesh::ask_dist(Int ent_dim) {
   return *(dists_[ent_dim]);
 }
 
+DistPlanPtr Mesh::ask_sync_plan(Int ent_dim, Int packet_bytes) {
+  auto& plan = sync_plans_[ent_dim][packet_bytes];
+  if (!plan) {
+    plan = std::make_shared<DistPlan>(ask_dist(ent_dim).invert(), packet_bytes);
+  }
+  return plan;
+}
+
 Omega_h_Parting Mesh::parting() const {
   OMEGA_H_CHECK(parting_ != -1);
   return Omega_h_Parting(parting_);
@@ -447,7 +471,14 @@ void Mesh::set_parting(Omega_h_Parting parting_in, Int nlayers, bool verbose) {
   }
   if (parting_in == OMEGA_H_ELEM_BASED) {
     OMEGA_H_CHECK(nlayers == 0);
-    if (comm_->size() > 1) partition_by_elems(this, verbose);
+    if (comm_->size() > 1) {
+      if (parting_ == OMEGA_H_GHOSTED) {
+        auto nbytes = unghost_mesh(this, verbose);
+        nunmigrated_bytes_ += nbytes;
+      } else {
+        partition_by_elems(this, verbose);
+      }
+    }
   } else if (parting_in == OMEGA_H_GHOSTED) {
     if (parting_ != OMEGA_H_GHOSTED || nlayers < nghost_layers_) {
       set_parting(OMEGA_H_ELEM_BASED, 0, false);
@@ -468,16 +499,13 @@ void Mesh::set_parting(Omega_h_Parting parting_in, bool verbose) {
     set_parting(parting_in, 1, verbose);
 }
 
+void Mesh::balance(bool predictive) { balance(OMEGA_H_RIB, predictive); }
+
 /* this is a member function mainly because it
    modifies the RIB hints */
-void Mesh::balance(bool predictive) {
+void Mesh::balance(Omega_h_Balance mode, bool predictive) {
   if (comm_->size() == 1) return;
   set_parting(OMEGA_H_ELEM_BASED);
-  inertia::Rib hints;
-  if (rib_hints_) hints = *rib_hints_;
-  auto ecoords =
-      average_field(this, dim(), LOs(nelems(), 0, 1), dim(), coords());
-  if (dim() < 3) ecoords = resize_vectors(ecoords, dim(), 3);
   Reals masses;
   Real abs_tol;
   if (predictive) {
@@ -493,11 +521,45 @@ void Mesh::balance(bool predictive) {
     abs_tol = 1.0;
   }
   abs_tol *= 2.0;  // fudge factor ?
-  auto owners = ask_owners(dim());
-  recursively_bisect(comm(), abs_tol, &ecoords, &masses, &owners, &hints);
-  rib_hints_ = std::make_shared<inertia::Rib>(hints);
-  auto unsorted_new2owners = Dist(comm_, owners, nelems());
-  auto owners2new = unsorted_new2owners.invert();
+  Dist owners2new;
+  if (mode == OMEGA_H_RIB) {
+    inertia::Rib hints;
+    if (rib_hints_) hints = *rib_hints_;
+    auto ecoords =
+        average_field(this, dim(), LOs(nelems(), 0, 1), dim(), coords());
+    if (dim() < 3) ecoords = resize_vectors(ecoords, dim(), 3);
+    auto owners = ask_owners(dim());
+    recursively_bisect(comm(), abs_tol, &ecoords, &masses, &owners, &hints);
+    rib_hints_ = std::make_shared<inertia::Rib>(hints);
+    auto unsorted_new2owners = Dist(comm_, owners, nelems());
+    owners2new = unsorted_new2owners.invert();
+  } else {
+    auto dual = multilevel::get_elem_dual(this, masses);
+    /* RIB keeps each half within (abs_tol) of its share of the mass,
+       the graph partitioners take the same bound relative to the
+       average part */
+    auto avg_mass = get_sum(comm_, masses) / comm_->size();
+    auto tolerance = 1.0;
+    if (avg_mass > 0.0) tolerance += abs_tol / avg_mass;
+    /* diffusion only moves elements between ranks that share sides,
+       so a rank with none, for example one left empty by set_comm(),
+       could never receive any */
+    if (mode == OMEGA_H_DIFFUSE) {
+      auto has_nbrs = get_sum(each_neq_to(dual.ab2b.ranks, comm_->rank())) > 0;
+      if (!comm_->reduce_and(has_nbrs)) mode = OMEGA_H_GRAPH_CUT;
+    }
+    Read<I32> dest_ranks;
+    if (mode == OMEGA_H_DIFFUSE) {
+      dest_ranks = diffusion::rebalance(dual, tolerance);
+      auto stays = (dest_ranks == Read<I32>(nelems(), comm_->rank()));
+      if (comm_->reduce_and(stays)) return;
+    } else {
+      dest_ranks = multilevel::partition(dual, mode, tolerance);
+    }
+    owners2new.set_parent_comm(comm_);
+    owners2new.set_dest_ranks(dest_ranks);
+    owners2new.set_roots2items(LOs(nelems() + 1, 0, 1));
+  }
   auto owner_globals = this->globals(dim());
   owners2new.set_dest_globals(owner_globals);
   auto sorted_new2owners = owners2new.invert();
@@ -520,7 +582,18 @@ Graph Mesh::ask_graph(Int from, Int to) {
 template <typename T>
 Read<T> Mesh::sync_array(Int ent_dim, Read<T> a, Int width) {
   if (!could_be_shared(ent_dim)) return a;
-  return ask_dist(ent_dim).invert().exch(a, width);
+  return ask_sync_plan(ent_dim, width * Int(sizeof(T)))->exch(a, width);
+}
+
+template <typename T>
+Future<T> Mesh::sync_array_begin(Int ent_dim, Read<T> a, Int width) {
+  if (!could_be_shared(ent_dim)) return Future<T>(a);
+  return ask_sync_plan(ent_dim, width * Int(sizeof(T)))->exch_begin(a, width);
+}
+
+template <typename T>
+Read<T> Mesh::sync_array_end(Future<T>& future) {
+  return future.get();
 }
 
 template <typename T>
@@ -636,10 +709,13 @@ Mesh Mesh::copy_meta() const {
   m.comm_ = this->comm_;
   m.parting_ = this->parting_;
   m.nghost_layers_ = this->nghost_layers_;
+  m.nunmigrated_bytes_ = this->nunmigrated_bytes_;
   m.rib_hints_ = this->rib_hints_;
   return m;
 }
 
+GO Mesh::nunmigrated_bytes() const { return nunmigrated_bytes_; }
+
 Mesh::RibPtr Mesh::rib_hints() const { return rib_hints_; }
 
 void Mesh::set_rib_hints(RibPtr hints) { rib_hints_ = hints; }
@@ -655,6 +731,17 @@ Real Mesh::imbalance(Int ent_dim) const {
   return m / a;
 }
 
+GO Mesh::edge_cut() {
+  /* ghosted elements would make sides look shared that are not cut */
+  OMEGA_H_CHECK(parting() == OMEGA_H_ELEM_BASED);
+  return count_owned_marks(this, dim() - 1, mark_shared(this, dim() - 1));
+}
+
+GO Mesh::comm_volume() {
+  auto ncopies = comm_->allreduce(GO(nverts()), OMEGA_H_SUM);
+  return ncopies - nglobal_ents(VERT);
+}
+
 bool can_print(Mesh* mesh) {
   return (!mesh->library()->silent_) && (mesh->comm()->rank() == 0);
 }
@@ -716,7 +803,12 @@ void ask_for_mesh_tags(Mesh* mesh, TagSet const& tags) {
       Read<T> array, bool internal);                                           \
   template void Mesh::set_tag(                                                 \
       Int dim, std::string const& name, Read<T> array, bool internal);         \
+  template void Mesh::add_lazy_tag(Int dim, std::string const& name,           \
+      Int ncomps, std::function<Read<T>()> loader);                            \
   template Read<T> Mesh::sync_array(Int ent_dim, Read<T> a, Int width);        \
+  template Future<T> Mesh::sync_array_begin(                                   \
+      Int ent_dim, Read<T> a, Int width);                                      \
+  template Read<T> Mesh::sync_array_end(Future<T>& future);                    \
   template Read<T> Mesh::owned_array(Int ent_dim, Read<T> a, Int width);       \
   template Read<T> Mesh::sync_subset_array(                                    \
       Int ent_dim, Read<T> a_data, LOs a2e, T default_val, Int width);         \
@@ -1,6 +1,7 @@
 #ifndef OMEGA_H_MESH_HPP
 #define OMEGA_H_MESH_HPP
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -45,6 +46,11 @@ class Mesh {
   template <typename T>
   void set_tag(
       Int dim, std::string const& name, Read<T> array, bool internal = false);
+  /* adds a tag whose array is only produced by (loader)
+     the first time it is asked for */
+  template <typename T>
+  void add_lazy_tag(Int dim, std::string const& name, Int ncomps,
+      std::function<Read<T>()> loader);
   TagBase const* get_tagbase(Int dim, std::string const& name) const;
   template <typename T>
   Tag<T> const* get_tag(Int dim, std::string const& name) const;
@@ -63,6 +69,7 @@ class Mesh {
   Adj ask_up(Int from, Int to);
   Graph ask_star(Int dim);
   Graph ask_dual();
+  void add_adj(Int from, Int to, Adj adj);
 
  public:
   typedef std::shared_ptr<TagBase> TagPtr;
@@ -78,19 +85,22 @@ class Mesh {
   TagCIter tag_iter(Int dim, std::string const& name) const;
   void check_dim(Int dim) const;
   void check_dim2(Int dim) const;
-  void add_adj(Int from, Int to, Adj adj);
   Adj derive_adj(Int from, Int to);
   Adj ask_adj(Int from, Int to);
   void react_to_set_tag(Int dim, std::string const& name);
+  DistPlanPtr ask_sync_plan(Int ent_dim, Int packet_bytes);
   Int dim_;
   CommPtr comm_;
   Int parting_;
   Int nghost_layers_;
+  GO nunmigrated_bytes_;
   LO nents_[DIMS];
   TagVector tags_[DIMS];
   AdjPtr adjs_[DIMS][DIMS];
   Remotes owners_[DIMS];
   DistPtr dists_[DIMS];
+  /* sync_array() plans, by packet size in bytes */
+  std::map<Int, DistPlanPtr> sync_plans_[DIMS];
   RibPtr rib_hints_;
   Library* library_;
 
@@ -109,10 +119,21 @@ class Mesh {
   Int nghost_layers() const;
   void set_parting(Omega_h_Parting parting_in, Int nlayers, bool verbose);
   void set_parting(Omega_h_Parting parting_in, bool verbose = false);
+  /* OMEGA_H_RIB splits each bisection evenly to within twice the
+     heaviest element weight, and the graph modes keep each part
+     within the same weight of the average part.
+     OMEGA_H_DIFFUSE falls back to OMEGA_H_GRAPH_CUT when some rank
+     shares no sides with another, since no elements could reach it */
   void balance(bool predictive = false);
+  void balance(Omega_h_Balance mode, bool predictive = false);
   Graph ask_graph(Int from, Int to);
   template <typename T>
   Read<T> sync_array(Int ent_dim, Read<T> a, Int width);
+  /* split-phase sync_array(), see Dist::exch_begin() */
+  template <typename T>
+  Future<T> sync_array_begin(Int ent_dim, Read<T> a, Int width);
+  template <typename T>
+  Read<T> sync_array_end(Future<T>& future);
   template <typename T>
   Read<T> sync_subset_array(
       Int ent_dim, Read<T> a_data, LOs a2e, T default_val, Int width);
@@ -132,6 +153,17 @@ class Mesh {
   RibPtr rib_hints() const;
   void set_rib_hints(RibPtr hints);
   Real imbalance(Int ent_dim = -1) const;
+  /* the number of sides between elements on different ranks,
+     i.e. the edge cut of the element dual graph.
+     the mesh must be element-based partitioned */
+  GO edge_cut();
+  /* the number of vertex copies that are not owned, i.e. how many
+     values a vertex sync_array() receives in total */
+  GO comm_volume();
+  /* bytes of tag data that this rank kept in place instead of
+     migrating them when going from ghosted to element based
+     partitioning, summed since the mesh was built */
+  GO nunmigrated_bytes() const;
 };
 
 bool can_print(Mesh* mesh);
@@ -144,9 +176,21 @@ Reals average_field(Mesh* mesh, Int dim, Int ncomps, Reals v2x);
 TagSet get_all_mesh_tags(Mesh* mesh);
 void ask_for_mesh_tags(Mesh* mesh, TagSet const& tags);
 
+/* renumber the entities on each rank along a Hilbert curve
+   through the vertex coordinates, or in Reverse Cuthill-McKee
+   order of the vertex graph, to improve memory locality.
+   global numbers are kept in parallel, a serial mesh
+   gets global numbers 0 to N-1 in the new order */
 void reorder_by_hilbert(Mesh* mesh);
+void reorder_by_rcm(Mesh* mesh);
 void reorder_by_globals(Mesh* mesh);
 
+/* the fraction of edges whose two vertices are within
+   LOCALITY_WINDOW of each other in the local numbering,
+   a rough measure of how well the ordering suits caches */
+enum { LOCALITY_WINDOW = 1024 };
+Real measure_locality(Mesh* mesh);
+
 #define OMEGA_H_EXPL_INST_DECL(T)                                              \
   extern template Tag<T> const* Mesh::get_tag<T>(                              \
       Int dim, std::string const& name) const;                                 \
@@ -158,7 +202,12 @@ void reorder_by_globals(Mesh* mesh);
       Int ncomps, Read<T> array, bool internal);                               \
   extern template void Mesh::set_tag(                                          \
       Int dim, std::string const& name, Read<T> array, bool internal);         \
+  extern template void Mesh::add_lazy_tag(Int dim, std::string const& name,   \
+      Int ncomps, std::function<Read<T>()> loader);                            \
   extern template Read<T> Mesh::sync_array(Int ent_dim, Read<T> a, Int width); \
+  extern template Future<T> Mesh::sync_array_begin(                            \
+      Int ent_dim, Read<T> a, Int width);                                      \
+  extern template Read<T> Mesh::sync_array_end(Future<T>& future);            \
   extern template Read<T> Mesh::owned_array(                                   \
       Int ent_dim, Read<T> a, Int width);                                      \
   extern template Read<T> Mesh::sync_subset_array(                             \
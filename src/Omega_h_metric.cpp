@@ -184,13 +184,17 @@ void axes_from_metric_field(Mesh* mesh, std::string const& metric_name,
 
 /* gradation limiting code: */
 
+/* the shared vertices are limited first so that their exchange
+   can be started before the interior vertices are limited,
+   hiding communication behind the bulk of the work */
+
 template <Int mesh_dim, Int metric_dim>
-static Reals limit_gradation_once_tmpl(
-    Mesh* mesh, Reals values, Real max_rate) {
+static Reals limit_gradation_once_tmpl(Mesh* mesh, Reals values, Real max_rate,
+    LOs shared_verts, LOs interior_verts) {
   auto v2v = mesh->ask_star(VERT);
   auto coords = mesh->coords();
-  auto out = Write<Real>(mesh->nverts() * symm_ncomps(metric_dim));
-  auto f = OMEGA_H_LAMBDA(LO v) {
+  auto ncomps = symm_ncomps(metric_dim);
+  auto limit = OMEGA_H_LAMBDA(LO v)->Matrix<metric_dim, metric_dim> {
     auto m = get_symm<metric_dim>(values, v);
     auto x = get_vector<mesh_dim>(coords, v);
     for (auto vv = v2v.a2ab[v]; vv < v2v.a2ab[v + 1]; ++vv) {
@@ -204,26 +208,47 @@ static Reals limit_gradation_once_tmpl(
       auto limited = intersect_metrics(m, limiter);
       m = limited;
     }
-    set_symm(out, v, m);
+    return m;
+  };
+  /* only the entries of shared vertices are meaningful in (shared_out),
+     and the interior ones of (out) must not be written while
+     (shared_out) is being sent */
+  auto shared_out = Write<Real>(mesh->nverts() * ncomps);
+  auto f_shared = OMEGA_H_LAMBDA(LO sv) {
+    auto v = shared_verts[sv];
+    set_symm(shared_out, v, limit(v));
   };
-  parallel_for(mesh->nverts(), f, "limit_metric_gradation");
-  values = Reals(out);
-  values = mesh->sync_array(VERT, values, symm_ncomps(metric_dim));
-  return values;
+  parallel_for(shared_verts.size(), f_shared, "limit_metric_gradation(shared)");
+  auto future = mesh->sync_array_begin(VERT, Reals(shared_out), ncomps);
+  auto out = Write<Real>(mesh->nverts() * ncomps);
+  auto f_interior = OMEGA_H_LAMBDA(LO iv) {
+    auto v = interior_verts[iv];
+    set_symm(out, v, limit(v));
+  };
+  parallel_for(interior_verts.size(), f_interior, "limit_metric_gradation");
+  auto synced = mesh->sync_array_end(future);
+  map_into(unmap(shared_verts, synced, ncomps), shared_verts, out, ncomps);
+  return out;
 }
 
-static Reals limit_gradation_once(Mesh* mesh, Reals values, Real max_rate) {
+static Reals limit_gradation_once(Mesh* mesh, Reals values, Real max_rate,
+    LOs shared_verts, LOs interior_verts) {
   auto metric_dim = get_metrics_dim(mesh->nverts(), values);
   if (mesh->dim() == 3 && metric_dim == 3) {
-    return limit_gradation_once_tmpl<3, 3>(mesh, values, max_rate);
+    return limit_gradation_once_tmpl<3, 3>(
+        mesh, values, max_rate, shared_verts, interior_verts);
   } else if (mesh->dim() == 2 && metric_dim == 2) {
-    return limit_gradation_once_tmpl<2, 2>(mesh, values, max_rate);
+    return limit_gradation_once_tmpl<2, 2>(
+        mesh, values, max_rate, shared_verts, interior_verts);
   } else if (mesh->dim() == 3 && metric_dim == 1) {
-    return limit_gradation_once_tmpl<3, 1>(mesh, values, max_rate);
+    return limit_gradation_once_tmpl<3, 1>(
+        mesh, values, max_rate, shared_verts, interior_verts);
   } else if (mesh->dim() == 2 && metric_dim == 1) {
-    return limit_gradation_once_tmpl<2, 1>(mesh, values, max_rate);
+    return limit_gradation_once_tmpl<2, 1>(
+        mesh, values, max_rate, shared_verts, interior_verts);
   } else if (mesh->dim() == 1) {
-    return limit_gradation_once_tmpl<1, 1>(mesh, values, max_rate);
+    return limit_gradation_once_tmpl<1, 1>(
+        mesh, values, max_rate, shared_verts, interior_verts);
   }
   OMEGA_H_NORETURN(Reals());
 }
@@ -233,11 +258,15 @@ Reals limit_metric_gradation(
   OMEGA_H_CHECK(mesh->owners_have_all_upward(VERT));
   OMEGA_H_CHECK(max_rate > 0.0);
   auto comm = mesh->comm();
+  auto shared = mark_shared(mesh, VERT);
+  auto shared_verts = collect_marked(shared);
+  auto interior_verts = collect_marked(invert_marks(shared));
   Reals values2 = values;
   Int i = 0;
   do {
     values = values2;
-    values2 = limit_gradation_once(mesh, values, max_rate);
+    values2 = limit_gradation_once(
+        mesh, values, max_rate, shared_verts, interior_verts);
     ++i;
     if (verbose && can_print(mesh) && i > 40) {
       std::cout << "warning: gradation limiting is up to step " << i << '\n';
@@ -127,24 +127,35 @@ void push_tags(Mesh const* old_mesh, Mesh* new_mesh, Int ent_dim,
     Dist old_owners2new_ents) {
   begin_code("push_tags");
   OMEGA_H_CHECK(old_owners2new_ents.nroots() == old_mesh->nents(ent_dim));
+  /* all tags travel together in one message per neighbor */
+  DistBundle bundle;
   for (Int i = 0; i < old_mesh->ntags(ent_dim); ++i) {
     auto tag = old_mesh->get_tag(ent_dim, i);
     if (is<I8>(tag)) {
-      auto array = as<I8>(tag)->array();
-      array = old_owners2new_ents.exch(array, tag->ncomps());
-      new_mesh->add_tag<I8>(ent_dim, tag->name(), tag->ncomps(), array, true);
+      bundle.add(as<I8>(tag)->array(), tag->ncomps());
     } else if (is<I32>(tag)) {
-      auto array = as<I32>(tag)->array();
-      array = old_owners2new_ents.exch(array, tag->ncomps());
-      new_mesh->add_tag<I32>(ent_dim, tag->name(), tag->ncomps(), array, true);
+      bundle.add(as<I32>(tag)->array(), tag->ncomps());
     } else if (is<I64>(tag)) {
-      auto array = as<I64>(tag)->array();
-      array = old_owners2new_ents.exch(array, tag->ncomps());
-      new_mesh->add_tag<I64>(ent_dim, tag->name(), tag->ncomps(), array, true);
+      bundle.add(as<I64>(tag)->array(), tag->ncomps());
     } else if (is<Real>(tag)) {
-      auto array = as<Real>(tag)->array();
-      array = old_owners2new_ents.exch(array, tag->ncomps());
-      new_mesh->add_tag<Real>(ent_dim, tag->name(), tag->ncomps(), array, true);
+      bundle.add(as<Real>(tag)->array(), tag->ncomps());
+    }
+  }
+  if (bundle.size()) bundle = old_owners2new_ents.exch(bundle);
+  for (Int i = 0; i < old_mesh->ntags(ent_dim); ++i) {
+    auto tag = old_mesh->get_tag(ent_dim, i);
+    if (is<I8>(tag)) {
+      new_mesh->add_tag<I8>(
+          ent_dim, tag->name(), tag->ncomps(), bundle.get<I8>(i), true);
+    } else if (is<I32>(tag)) {
+      new_mesh->add_tag<I32>(
+          ent_dim, tag->name(), tag->ncomps(), bundle.get<I32>(i), true);
+    } else if (is<I64>(tag)) {
+      new_mesh->add_tag<I64>(
+          ent_dim, tag->name(), tag->ncomps(), bundle.get<I64>(i), true);
+    } else if (is<Real>(tag)) {
+      new_mesh->add_tag<Real>(
+          ent_dim, tag->name(), tag->ncomps(), bundle.get<Real>(i), true);
     }
   }
   end_code();
@@ -65,6 +65,118 @@ static void modify_conn(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
   end_code();
 }
 
+/* derive the upward adjacency from new entities of dimension
+   (ent_dim - 1) to new entities of dimension (ent_dim) by patching
+   the old one instead of inverting the whole downward adjacency.
+   A low entity that stays the same keeps its old upward adjacent
+   entities which survived (their relative order is preserved by
+   the renumbering) and gains the products adjacent to it, which
+   are merged in by index.
+   Products only ever bound other products, so all work beyond
+   copying is proportional to the number of products, and the
+   result is identical to what invert_adj() would derive. */
+static void modify_up(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
+    LOs prods2new_ents, LOs old_ents2new_ents, LOs old_lows2new_lows) {
+  auto low_dim = ent_dim - 1;
+  if (!old_mesh->has_adj(low_dim, ent_dim)) return;
+  begin_code("modify_up");
+  auto old_lows2old_ents = old_mesh->get_adj(low_dim, ent_dim);
+  auto old_l2le = old_lows2old_ents.a2ab;
+  auto old_le2e = old_lows2old_ents.ab2b;
+  auto old_le_codes = old_lows2old_ents.codes;
+  auto nold_lows = old_mesh->nents(low_dim);
+  auto nnew_lows = new_mesh->nents(low_dim);
+  auto down_degree = simplex_degrees[ent_dim][low_dim];
+  auto new_ents2new_lows = new_mesh->ask_down(ent_dim, low_dim);
+  auto new_el2l = new_ents2new_lows.ab2b;
+  auto new_el_codes = new_ents2new_lows.codes;
+  auto nprods = prods2new_ents.size();
+  Write<LO> new_lows2old_lows(nnew_lows, -1);
+  auto invert = OMEGA_H_LAMBDA(LO old_low) {
+    auto new_low = old_lows2new_lows[old_low];
+    if (new_low >= 0) new_lows2old_lows[new_low] = old_low;
+  };
+  parallel_for(nold_lows, invert, "modify_up(invert)");
+  Write<LO> degrees(nnew_lows, 0);
+  auto count_same = OMEGA_H_LAMBDA(LO new_low) {
+    auto old_low = new_lows2old_lows[new_low];
+    if (old_low < 0) return;
+    LO n = 0;
+    for (auto le = old_l2le[old_low]; le < old_l2le[old_low + 1]; ++le) {
+      if (old_ents2new_ents[old_le2e[le]] >= 0) ++n;
+    }
+    degrees[new_low] = n;
+  };
+  parallel_for(nnew_lows, count_same, "modify_up(count_same)");
+  auto nsame_adj = deep_copy(LOs(degrees));
+  auto count_prods = OMEGA_H_LAMBDA(LO prod) {
+    auto new_ent = prods2new_ents[prod];
+    for (Int el = 0; el < down_degree; ++el) {
+      atomic_increment(&degrees[new_el2l[new_ent * down_degree + el]]);
+    }
+  };
+  parallel_for(nprods, count_prods, "modify_up(count_prods)");
+  auto new_l2le = offset_scan(LOs(degrees));
+  auto nnew_le = new_l2le.last();
+  Write<LO> new_le2e(nnew_le);
+  Write<I8> new_le_codes(nnew_le);
+  auto fill_same = OMEGA_H_LAMBDA(LO new_low) {
+    auto old_low = new_lows2old_lows[new_low];
+    if (old_low < 0) return;
+    auto new_le = new_l2le[new_low];
+    for (auto le = old_l2le[old_low]; le < old_l2le[old_low + 1]; ++le) {
+      auto new_ent = old_ents2new_ents[old_le2e[le]];
+      if (new_ent < 0) continue;
+      new_le2e[new_le] = new_ent;
+      new_le_codes[new_le] = old_le_codes[le];
+      ++new_le;
+    }
+  };
+  parallel_for(nnew_lows, fill_same, "modify_up(fill_same)");
+  Write<LO> positions(nnew_lows);
+  auto start_prods = OMEGA_H_LAMBDA(LO new_low) {
+    positions[new_low] = new_l2le[new_low] + nsame_adj[new_low];
+  };
+  parallel_for(nnew_lows, start_prods, "modify_up(start_prods)");
+  auto fill_prods = OMEGA_H_LAMBDA(LO prod) {
+    auto new_ent = prods2new_ents[prod];
+    for (Int el = 0; el < down_degree; ++el) {
+      auto new_low = new_el2l[new_ent * down_degree + el];
+      auto new_le = atomic_fetch_add<LO>(&positions[new_low], 1);
+      new_le2e[new_le] = new_ent;
+      if (low_dim == VERT) {
+        new_le_codes[new_le] = make_code(false, 0, el);
+      } else {
+        auto down_code = new_el_codes[new_ent * down_degree + el];
+        new_le_codes[new_le] = make_code(code_is_flipped(down_code),
+            code_rotation(down_code), el);
+      }
+    }
+  };
+  parallel_for(nprods, fill_prods, "modify_up(fill_prods)");
+  /* each list is a sorted run of same entities followed by
+     a few products in arbitrary order: insertion sort */
+  auto merge = OMEGA_H_LAMBDA(LO new_low) {
+    auto begin = new_l2le[new_low];
+    auto end = new_l2le[new_low + 1];
+    for (auto j = begin + nsame_adj[new_low]; j < end; ++j) {
+      auto ent = new_le2e[j];
+      auto code = new_le_codes[j];
+      auto k = j;
+      for (; k > begin && new_le2e[k - 1] > ent; --k) {
+        new_le2e[k] = new_le2e[k - 1];
+        new_le_codes[k] = new_le_codes[k - 1];
+      }
+      new_le2e[k] = ent;
+      new_le_codes[k] = code;
+    }
+  };
+  parallel_for(nnew_lows, merge, "modify_up(merge)");
+  new_mesh->add_adj(low_dim, ent_dim,
+      Adj(new_l2le, LOs(new_le2e), Read<I8>(new_le_codes)));
+  end_code();
+}
+
 /* set the owners of the mesh after an adaptive rebuild pass.
    the entities that stay the same retain the same conceptual
    ownership, just updated by unmap_owners() to reflect new indices.
@@ -349,6 +461,39 @@ static void modify_globals(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
   end_code();
 }
 
+/* vertices of new elements become dirty for every operation,
+   the others keep what they had */
+static void modify_dirty(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
+    LOs prods2new_ents, LOs same_ents2old_ents, LOs same_ents2new_ents) {
+  if (!old_mesh->has_tag(VERT, "dirty")) return;
+  if (ent_dim == VERT) {
+    auto old_dirty = old_mesh->get_array<I8>(VERT, "dirty");
+    if (kept_numbering(
+            old_mesh->nverts(), prods2new_ents, same_ents2old_ents)) {
+      new_mesh->add_tag(VERT, "dirty", 1, old_dirty, true);
+    } else {
+      Write<I8> new_dirty(new_mesh->nverts(), I8(ALL_DIRTY));
+      remap_into(
+          old_dirty, same_ents2old_ents, same_ents2new_ents, new_dirty, 1);
+      new_mesh->add_tag(VERT, "dirty", 1, Read<I8>(new_dirty), true);
+    }
+  }
+  if (ent_dim == new_mesh->dim()) {
+    /* only this rank's copies are set, mark_dirty() unites them */
+    auto nverts_per_elem = simplex_degrees[ent_dim][VERT];
+    auto elem_verts2verts = new_mesh->ask_elem_verts();
+    auto new_dirty = deep_copy(new_mesh->get_array<I8>(VERT, "dirty"));
+    auto f = OMEGA_H_LAMBDA(LO prod) {
+      auto e = prods2new_ents[prod];
+      for (Int ev = 0; ev < nverts_per_elem; ++ev) {
+        new_dirty[elem_verts2verts[e * nverts_per_elem + ev]] = I8(ALL_DIRTY);
+      }
+    };
+    parallel_for(prods2new_ents.size(), f, "modify_dirty");
+    new_mesh->set_tag(VERT, "dirty", Read<I8>(new_dirty), true);
+  }
+}
+
 void modify_ents(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim, Int key_dim,
     LOs keys2kds, LOs keys2prods, LOs prod_verts2verts, LOs old_lows2new_lows,
     LOs* p_prods2new_ents, LOs* p_same_ents2old_ents, LOs* p_same_ents2new_ents,
@@ -381,6 +526,8 @@ void modify_ents(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim, Int key_dim,
     modify_conn(old_mesh, new_mesh, ent_dim, prod_verts2verts,
         *p_prods2new_ents, *p_same_ents2old_ents, *p_same_ents2new_ents,
         old_lows2new_lows);
+    modify_up(old_mesh, new_mesh, ent_dim, *p_prods2new_ents,
+        *p_old_ents2new_ents, old_lows2new_lows);
   }
   if (old_mesh->comm()->size() > 1) {
     modify_owners(old_mesh, new_mesh, ent_dim, *p_prods2new_ents,
@@ -391,9 +538,17 @@ void modify_ents(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim, Int key_dim,
   modify_globals(old_mesh, new_mesh, ent_dim, key_dim, keys2kds, keys2prods,
       *p_prods2new_ents, *p_same_ents2old_ents, *p_same_ents2new_ents,
       keys2reps, global_rep_counts);
+  modify_dirty(old_mesh, new_mesh, ent_dim, *p_prods2new_ents,
+      *p_same_ents2old_ents, *p_same_ents2new_ents);
   end_code();
 }
 
+bool kept_numbering(LO nold_ents, LOs prods2new_ents, LOs same_ents2old_ents) {
+  /* both maps are increasing, so when nothing was produced and
+     nothing removed they are the identity */
+  return prods2new_ents.size() == 0 && same_ents2old_ents.size() == nold_ents;
+}
+
 void set_owners_by_indset(
     Mesh* mesh, Int key_dim, LOs keys2kds, Graph kds2elems) {
   if (mesh->comm()->size() == 1) return;
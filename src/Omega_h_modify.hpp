@@ -15,6 +15,11 @@ void modify_ents(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim, Int key_dim,
     LOs* p_prods2new_ents, LOs* p_same_ents2old_ents, LOs* p_same_ents2new_ents,
     LOs* p_old_ents2new_ents);
 
+/* true when modify_ents neither produced nor removed entities of
+   this dimension, which leaves their numbering unchanged and lets
+   the new mesh share arrays of the old one instead of copying them */
+bool kept_numbering(LO nold_ents, LOs prods2new_ents, LOs same_ents2old_ents);
+
 void set_owners_by_indset(
     Mesh* mesh, Int key_dim, LOs keys2kds, Graph kds2elems);
 
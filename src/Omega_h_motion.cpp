@@ -2,7 +2,10 @@
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_indset.hpp"
 #include "Omega_h_map.hpp"
+#include "Omega_h_mark.hpp"
 #include "Omega_h_modify.hpp"
+#include "Omega_h_quality.hpp"
+#include "Omega_h_shape.hpp"
 #include "Omega_h_transfer.hpp"
 
 #include <iostream>
@@ -71,4 +74,90 @@ bool move_verts_to_conserve_size(Mesh* mesh, AdaptOpts const& opts) {
   return true;
 }
 
+/* re-measures the cached (name) of the entities that moved,
+   keeping the values of the others */
+static void remeasure_moved(Mesh* mesh, Int ent_dim, std::string const& name,
+    Read<I8> ents_did_move, Reals (*measure)(Mesh*, LOs)) {
+  if (!mesh->has_tag(ent_dim, name)) return;
+  auto moved2ents = collect_marked(ents_did_move);
+  auto values = deep_copy(mesh->get_array<Real>(ent_dim, name));
+  map_into(measure(mesh, moved2ents), moved2ents, values, 1);
+  mesh->set_tag(ent_dim, name, Reals(values), true);
+}
+
+/* interior vertices of elements below the desired quality,
+   any partitioning sees each such vertex on at least one rank */
+static Read<I8> mark_sliver_verts(Mesh* mesh, AdaptOpts const& opts) {
+  auto dim = mesh->dim();
+  auto elems_are_slivers =
+      each_lt(mesh->ask_qualities(), opts.min_quality_desired);
+  auto verts_are_cands = mark_down(mesh, dim, VERT, elems_are_slivers);
+  return land_each(verts_are_cands, mark_by_class_dim(mesh, VERT, dim));
+}
+
+bool smooth_slivers(Mesh* mesh, AdaptOpts const& opts) {
+  /* element sizes change, which these fields need
+     move_verts_to_conserve_size and its rebuild to follow */
+  if (has_densities_or_conserved(mesh, opts.xfer_opts) ||
+      has_momentum_velocity(mesh, opts.xfer_opts)) {
+    return false;
+  }
+  begin_code("smooth_slivers");
+  auto comm = mesh->comm();
+  /* spare the ghosting and unghosting when there is nothing to move */
+  if (get_max(comm, mark_sliver_verts(mesh, opts)) != 1) {
+    end_code();
+    return false;
+  }
+  mesh->set_parting(OMEGA_H_GHOSTED);
+  auto dim = mesh->dim();
+  auto verts_are_cands = mark_sliver_verts(mesh, opts);
+  auto cands2verts = collect_marked(verts_are_cands);
+  auto choices = get_smooth_choices(mesh, opts, cands2verts);
+  verts_are_cands =
+      map_onto(choices.did_move, cands2verts, mesh->nverts(), I8(0), 1);
+  auto ret = (get_max(comm, verts_are_cands) == 1);
+  if (ret) {
+    auto vert_quals =
+        map_onto(choices.new_quals, cands2verts, mesh->nverts(), -1.0, 1);
+    auto verts_are_keys =
+        find_indset(mesh, VERT, vert_quals, verts_are_cands);
+    if (opts.verbosity >= EACH_REBUILD) {
+      auto ntotal_keys = count_owned_marks(mesh, VERT, verts_are_keys);
+      if (comm->rank() == 0) {
+        std::cout << "smoothing " << ntotal_keys << " vertices\n";
+      }
+    }
+    /* no two keys share an element, so they all move at once
+       and the copies of a key agree since choices were synced */
+    auto cands_are_keys = unmap(cands2verts, verts_are_keys, 1);
+    auto keys2cands = collect_marked(cands_are_keys);
+    auto keys2verts = unmap(keys2cands, cands2verts, 1);
+    auto new_coords = deep_copy(mesh->coords());
+    map_into(unmap(keys2cands, choices.new_coords, dim), keys2verts,
+        new_coords, dim);
+    mesh->set_tag(VERT, "coordinates", Reals(new_coords), true);
+    auto elems_did_move = mark_up(mesh, VERT, dim, verts_are_keys);
+    remeasure_moved(mesh, EDGE, "length",
+        mark_up(mesh, VERT, EDGE, verts_are_keys), measure_edges_metric);
+    remeasure_moved(
+        mesh, dim, "quality", elems_did_move, measure_qualities);
+    remeasure_moved(
+        mesh, dim, "size", elems_did_move, measure_elements_real);
+    if (mesh->has_tag(VERT, "dirty")) {
+      auto verts_are_dirty = mark_down(mesh, dim, VERT, elems_did_move);
+      auto dirty = mesh->get_array<I8>(VERT, "dirty");
+      Write<I8> new_dirty(mesh->nverts());
+      auto f = OMEGA_H_LAMBDA(LO v) {
+        new_dirty[v] = verts_are_dirty[v] ? I8(ALL_DIRTY) : dirty[v];
+      };
+      parallel_for(mesh->nverts(), f, "smooth_slivers(dirty)");
+      mesh->set_tag(VERT, "dirty", Read<I8>(new_dirty), true);
+    }
+  }
+  mesh->set_parting(OMEGA_H_ELEM_BASED, false);
+  end_code();
+  return ret;
+}
+
 }  // end namespace Omega_h
@@ -27,6 +27,17 @@ MotionChoices get_motion_choices(
 
 bool move_verts_to_conserve_size(Mesh* mesh, AdaptOpts const& opts);
 
+/* for vertices of elements below (opts.min_quality_desired),
+   positions that raise the minimum quality around them */
+MotionChoices get_smooth_choices(
+    Mesh* mesh, AdaptOpts const& opts, LOs cands2verts);
+
+/* moves an independent set of interior vertices of low quality
+   elements to raise the quality around them. the topology is kept,
+   so only the coordinates and the caches of moved entities change.
+   returns false if no vertex moved */
+bool smooth_slivers(Mesh* mesh, AdaptOpts const& opts);
+
 }  // namespace Omega_h
 
 #endif
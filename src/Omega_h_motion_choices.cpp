@@ -165,4 +165,153 @@ MotionChoices get_motion_choices(
   OMEGA_H_NORETURN(MotionChoices());
 }
 
+/* the quality of the element at (v2k) index (vk) when
+   its vertex from (v2k) is placed at (x) */
+template <Int mesh_dim, Int metric_dim>
+OMEGA_H_DEVICE Real smooth_elem_quality(Adj const& v2k, LOs const& kv2v,
+    Reals const& coords, Reals const& metrics, LO vk, Vector<mesh_dim> x) {
+  auto k = v2k.ab2b[vk];
+  auto kkv_c = code_which_down(v2k.codes[vk]);
+  auto kkv2v = gather_verts<mesh_dim + 1>(kv2v, k);
+  auto kkv2nx = gather_vectors<mesh_dim + 1, mesh_dim>(coords, kkv2v);
+  kkv2nx[kkv_c] = x;
+  auto kvv2m = gather_symms<mesh_dim + 1, metric_dim>(metrics, kkv2v);
+  auto km = maxdet_metric(kvv2m);
+  return metric_element_quality(kkv2nx, km);
+}
+
+/* the minimum quality of the elements around (v) when it is placed
+   at (x), and in (p_worst) the (v2k) index of the element attaining it.
+   positions making an edge longer than (max_ml) get quality -1 */
+template <Int mesh_dim, Int metric_dim>
+OMEGA_H_DEVICE Real smooth_cavity_quality(Adj const& v2k, LOs const& kv2v,
+    Adj const& v2e, LOs const& ev2v, Reals const& coords,
+    Reals const& metrics, Real max_ml, LO v, Vector<mesh_dim> x,
+    LO* p_worst) {
+  *p_worst = v2k.a2ab[v];
+  for (auto ve = v2e.a2ab[v]; ve < v2e.a2ab[v + 1]; ++ve) {
+    auto e = v2e.ab2b[ve];
+    auto eev_c = code_which_down(v2e.codes[ve]);
+    auto eev2v = gather_verts<2>(ev2v, e);
+    auto eev2nx = gather_vectors<2, mesh_dim>(coords, eev2v);
+    eev2nx[eev_c] = x;
+    auto eev2m = gather_symms<2, metric_dim>(metrics, eev2v);
+    if (metric_edge_length(eev2nx, eev2m) > max_ml) return -1.0;
+  }
+  Real min_qual = 1.0;
+  for (auto vk = v2k.a2ab[v]; vk < v2k.a2ab[v + 1]; ++vk) {
+    auto k_qual = smooth_elem_quality<mesh_dim, metric_dim>(
+        v2k, kv2v, coords, metrics, vk, x);
+    if (k_qual < min_qual) {
+      min_qual = k_qual;
+      *p_worst = vk;
+    }
+  }
+  return min_qual;
+}
+
+template <Int mesh_dim, Int metric_dim>
+MotionChoices smooth_choices_tmpl(
+    Mesh* mesh, AdaptOpts const& opts, LOs cands2verts) {
+  Int max_steps = 10;
+  Int max_backtracks = 8;
+  Real min_improvement = 1e-3;
+  auto max_ml_allowed = opts.max_length_allowed;
+  auto coords = mesh->coords();
+  auto metrics = mesh->get_array<Real>(VERT, "metric");
+  auto ncands = cands2verts.size();
+  auto v2e = mesh->ask_up(VERT, EDGE);
+  auto ev2v = mesh->ask_verts_of(EDGE);
+  auto v2k = mesh->ask_up(VERT, mesh_dim);
+  auto kv2v = mesh->ask_verts_of(mesh_dim);
+  auto did_move_w = Write<I8>(ncands);
+  auto new_coords_w = Write<Real>(ncands * mesh_dim);
+  auto new_quals_w = Write<Real>(ncands);
+  auto f = OMEGA_H_LAMBDA(LO cand) {
+    auto v = cands2verts[cand];
+    auto orig_x = get_vector<mesh_dim>(coords, v);
+    Real min_rl = ArithTraits<Real>::max();
+    for (auto ve = v2e.a2ab[v]; ve < v2e.a2ab[v + 1]; ++ve) {
+      auto e = v2e.ab2b[ve];
+      auto eev_c = code_which_down(v2e.codes[ve]);
+      auto ov = ev2v[e * 2 + (1 - eev_c)];
+      auto ox = get_vector<mesh_dim>(coords, ov);
+      min_rl = min2(min_rl, norm(orig_x - ox));
+    }
+    LO worst = -1;
+    auto orig_qual = smooth_cavity_quality<mesh_dim, metric_dim>(v2k, kv2v,
+        v2e, ev2v, coords, metrics, max_ml_allowed, v, orig_x, &worst);
+    auto x = orig_x;
+    auto qual = orig_qual;
+    /* steepest ascent of the worst element's quality, accepting
+       only steps that raise the minimum over all elements */
+    for (Int step = 0; step < max_steps && qual > 0.0; ++step) {
+      auto eps = 1e-4 * min_rl;
+      Vector<mesh_dim> grad;
+      for (Int i = 0; i < mesh_dim; ++i) {
+        auto dx = zero_vector<mesh_dim>();
+        dx[i] = eps;
+        auto q_plus = smooth_elem_quality<mesh_dim, metric_dim>(
+            v2k, kv2v, coords, metrics, worst, x + dx);
+        auto q_minus = smooth_elem_quality<mesh_dim, metric_dim>(
+            v2k, kv2v, coords, metrics, worst, x - dx);
+        grad[i] = (q_plus - q_minus) / (2.0 * eps);
+      }
+      auto grad_norm = norm(grad);
+      if (grad_norm == 0.0) break;
+      auto dir = grad / grad_norm;
+      auto dist = min_rl / 2.0;
+      bool did_improve = false;
+      for (Int backtrack = 0; backtrack < max_backtracks; ++backtrack) {
+        auto try_x = x + dir * dist;
+        LO try_worst = -1;
+        auto try_qual = smooth_cavity_quality<mesh_dim, metric_dim>(v2k,
+            kv2v, v2e, ev2v, coords, metrics, max_ml_allowed, v, try_x,
+            &try_worst);
+        if (try_qual > qual) {
+          x = try_x;
+          qual = try_qual;
+          worst = try_worst;
+          did_improve = true;
+          break;
+        }
+        dist /= 2.0;
+      }
+      if (!did_improve) break;
+    }
+    auto did_move = (qual > orig_qual + min_improvement);
+    if (!did_move) x = orig_x;
+    did_move_w[cand] = I8(did_move);
+    new_quals_w[cand] = qual;
+    set_vector(new_coords_w, cand, x);
+  };
+  parallel_for(ncands, f, "smooth_choices");
+  auto did_move = Bytes(did_move_w);
+  auto new_quals = Reals(new_quals_w);
+  auto new_coords = Reals(new_coords_w);
+  did_move = mesh->sync_subset_array(VERT, did_move, cands2verts, I8(-1), 1);
+  new_quals = mesh->sync_subset_array(VERT, new_quals, cands2verts, -1.0, 1);
+  new_coords =
+      mesh->sync_subset_array(VERT, new_coords, cands2verts, 0.0, mesh_dim);
+  return {did_move, new_quals, new_coords};
+}
+
+MotionChoices get_smooth_choices(
+    Mesh* mesh, AdaptOpts const& opts, LOs cands2verts) {
+  auto metric_dim = get_metric_dim(mesh);
+  if (mesh->dim() == 3 && metric_dim == 3) {
+    return smooth_choices_tmpl<3, 3>(mesh, opts, cands2verts);
+  }
+  if (mesh->dim() == 2 && metric_dim == 2) {
+    return smooth_choices_tmpl<2, 2>(mesh, opts, cands2verts);
+  }
+  if (mesh->dim() == 3 && metric_dim == 1) {
+    return smooth_choices_tmpl<3, 1>(mesh, opts, cands2verts);
+  }
+  if (mesh->dim() == 2 && metric_dim == 1) {
+    return smooth_choices_tmpl<2, 1>(mesh, opts, cands2verts);
+  }
+  OMEGA_H_NORETURN(MotionChoices());
+}
+
 }  // end namespace Omega_h
@@ -0,0 +1,627 @@
+#include "Omega_h_multilevel.hpp"
+
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "Omega_h_array_ops.hpp"
+#include "Omega_h_dist.hpp"
+#include "Omega_h_loop.hpp"
+#include "Omega_h_mesh.hpp"
+
+namespace Omega_h {
+
+namespace multilevel {
+
+DistGraph get_elem_dual(Mesh* mesh, Reals elem_weights) {
+  OMEGA_H_CHECK(mesh->parting() == OMEGA_H_ELEM_BASED);
+  auto dim = mesh->dim();
+  auto comm = mesh->comm();
+  auto rank = comm->rank();
+  auto nelems = mesh->nelems();
+  auto nsides = mesh->nents(dim - 1);
+  /* in an element-based partition, a side between two ranks
+     has one adjacent element on each of them.
+     the owner of the side collects both and sends the
+     pair back to each copy */
+  auto sides2elems = mesh->ask_up(dim - 1, dim);
+  auto s2se = sides2elems.a2ab;
+  auto se2e = sides2elems.ab2b;
+  Write<LO> lone_elems(nsides);
+  auto f = OMEGA_H_LAMBDA(LO s) {
+    lone_elems[s] = ((s2se[s + 1] - s2se[s]) == 1) ? se2e[s2se[s]] : -1;
+  };
+  parallel_for(nsides, f, "get_elem_dual(lone)");
+  auto copies2owners = mesh->ask_dist(dim - 1);
+  auto owners2copies = copies2owners.invert();
+  auto serv_copies2elems = copies2owners.exch(LOs(lone_elems), 1);
+  auto serv_copies2clients = owners2copies.items2msgs();
+  auto clients2ranks = owners2copies.msgs2ranks();
+  auto owners2serv_copies = owners2copies.roots2items();
+  Write<LO> owners2pairs(nsides * 4, -1);
+  auto g = OMEGA_H_LAMBDA(LO s) {
+    auto begin = owners2serv_copies[s];
+    if (owners2serv_copies[s + 1] - begin != 2) return;
+    for (Int i = 0; i < 2; ++i) {
+      auto elem = serv_copies2elems[begin + i];
+      if (elem == -1) return;
+      owners2pairs[s * 4 + i * 2 + 0] =
+          clients2ranks[serv_copies2clients[begin + i]];
+      owners2pairs[s * 4 + i * 2 + 1] = elem;
+    }
+  };
+  parallel_for(nsides, g, "get_elem_dual(pairs)");
+  auto sides2pairs = HostRead<LO>(owners2copies.exch(LOs(owners2pairs), 4));
+  auto host_lone_elems = HostRead<LO>(LOs(lone_elems));
+  auto dual = mesh->ask_dual();
+  auto host_e2ee = HostRead<LO>(dual.a2ab);
+  auto host_ee2e = HostRead<LO>(dual.ab2b);
+  std::vector<std::vector<std::pair<I32, LO>>> remote_adj(
+      static_cast<std::size_t>(nelems));
+  for (LO s = 0; s < nsides; ++s) {
+    auto elem = host_lone_elems[s];
+    if (elem == -1 || sides2pairs[s * 4] == -1) continue;
+    for (Int i = 0; i < 2; ++i) {
+      auto other_rank = sides2pairs[s * 4 + i * 2 + 0];
+      auto other_elem = sides2pairs[s * 4 + i * 2 + 1];
+      if (other_rank == rank && other_elem == elem) continue;
+      remote_adj[std::size_t(elem)].push_back(
+          std::make_pair(other_rank, other_elem));
+    }
+  }
+  HostWrite<LO> e2ee(nelems + 1);
+  e2ee[0] = 0;
+  for (LO e = 0; e < nelems; ++e) {
+    e2ee[e + 1] = e2ee[e] + (host_e2ee[e + 1] - host_e2ee[e]) +
+                  LO(remote_adj[std::size_t(e)].size());
+  }
+  auto nedges = e2ee[nelems];
+  HostWrite<I32> ee2ranks(nedges);
+  HostWrite<LO> ee2idxs(nedges);
+  for (LO e = 0; e < nelems; ++e) {
+    auto ee = e2ee[e];
+    for (auto le = host_e2ee[e]; le < host_e2ee[e + 1]; ++le, ++ee) {
+      ee2ranks[ee] = rank;
+      ee2idxs[ee] = host_ee2e[le];
+    }
+    for (auto adj : remote_adj[std::size_t(e)]) {
+      ee2ranks[ee] = adj.first;
+      ee2idxs[ee] = adj.second;
+      ++ee;
+    }
+  }
+  DistGraph graph;
+  graph.comm = comm;
+  graph.weights = elem_weights;
+  graph.a2ab = e2ee.write();
+  graph.ab2b = Remotes(ee2ranks.write(), ee2idxs.write());
+  graph.ab_weights = Reals(nedges, 1.0);
+  return graph;
+}
+
+namespace {
+
+/* matching nodes and moving them between parts are
+   decisions made one node at a time, after looking at
+   the decisions made for earlier nodes, so this is done
+   in host memory */
+
+template <typename T>
+Read<T> to_read(std::vector<T> const& v) {
+  HostWrite<T> h(LO(v.size()));
+  for (LO i = 0; i < h.size(); ++i) h[i] = v[std::size_t(i)];
+  return h.write();
+}
+
+template <typename T>
+std::vector<T> to_vector(Read<T> a) {
+  HostRead<T> h(a);
+  std::vector<T> v(static_cast<std::size_t>(h.size()));
+  for (LO i = 0; i < h.size(); ++i) v[std::size_t(i)] = h[i];
+  return v;
+}
+
+struct Level {
+  std::vector<Real> weights;
+  std::vector<LO> a2ab;
+  std::vector<I32> ab2ranks;
+  std::vector<LO> ab2idxs;
+  std::vector<Real> ab_weights;
+  /* the node of the next coarser level that each node is part of */
+  std::vector<LO> fine2coarse;
+  /* brings data of each node to the edges leading to it */
+  Dist nodes2edges;
+  LO nnodes() const { return LO(weights.size()); }
+  LO nedges() const { return LO(ab2idxs.size()); }
+  LO degree(LO a) const {
+    return a2ab[std::size_t(a + 1)] - a2ab[std::size_t(a)];
+  }
+};
+
+void setup_exchange(CommPtr comm, Level* level) {
+  auto edges2nodes = Dist(comm,
+      Remotes(to_read(level->ab2ranks), to_read(level->ab2idxs)),
+      level->nnodes());
+  level->nodes2edges = edges2nodes.invert();
+}
+
+template <typename T>
+std::vector<T> pull(Level const& level, std::vector<T> const& data, Int width) {
+  return to_vector(level.nodes2edges.exch(to_read(data), width));
+}
+
+/* heavy-edge matching: each node is merged with the unmatched
+   neighbor it shares the heaviest edge with, unless the result
+   would weigh more than (max_weight).
+   only neighbors on the same rank are matched, so the coarse
+   nodes stay on the rank of their fine nodes */
+Level coarsen(CommPtr comm, Level* fine, Real max_weight) {
+  auto rank = comm->rank();
+  auto n = fine->nnodes();
+  std::vector<LO> order(static_cast<std::size_t>(n));
+  for (LO a = 0; a < n; ++a) order[std::size_t(a)] = a;
+  /* low degree nodes have the fewest choices, let them go first */
+  std::stable_sort(order.begin(), order.end(),
+      [fine](LO a, LO b) { return fine->degree(a) < fine->degree(b); });
+  std::vector<LO> match(std::size_t(n), -1);
+  for (auto a : order) {
+    if (match[std::size_t(a)] != -1) continue;
+    LO best = -1;
+    Real best_weight = 0.0;
+    for (auto ab = fine->a2ab[std::size_t(a)];
+         ab < fine->a2ab[std::size_t(a + 1)]; ++ab) {
+      if (fine->ab2ranks[std::size_t(ab)] != rank) continue;
+      auto b = fine->ab2idxs[std::size_t(ab)];
+      if (match[std::size_t(b)] != -1) continue;
+      if (fine->weights[std::size_t(a)] + fine->weights[std::size_t(b)] >
+          max_weight) {
+        continue;
+      }
+      if (best == -1 || fine->ab_weights[std::size_t(ab)] > best_weight) {
+        best = b;
+        best_weight = fine->ab_weights[std::size_t(ab)];
+      }
+    }
+    if (best == -1) {
+      match[std::size_t(a)] = a;
+    } else {
+      match[std::size_t(a)] = best;
+      match[std::size_t(best)] = a;
+    }
+  }
+  Level coarse;
+  std::vector<LO> coarse2fine;
+  fine->fine2coarse.assign(std::size_t(n), -1);
+  for (LO a = 0; a < n; ++a) {
+    auto b = match[std::size_t(a)];
+    if (b < a) continue;
+    fine->fine2coarse[std::size_t(a)] = LO(coarse2fine.size());
+    fine->fine2coarse[std::size_t(b)] = LO(coarse2fine.size());
+    coarse2fine.push_back(a);
+    auto weight = fine->weights[std::size_t(a)];
+    if (b != a) weight += fine->weights[std::size_t(b)];
+    coarse.weights.push_back(weight);
+  }
+  auto ab2coarse = pull(*fine, fine->fine2coarse, 1);
+  coarse.a2ab.push_back(0);
+  std::map<std::pair<I32, LO>, Real> edges;
+  for (LO c = 0; c < coarse.nnodes(); ++c) {
+    edges.clear();
+    auto a = coarse2fine[std::size_t(c)];
+    LO const members[2] = {a, match[std::size_t(a)]};
+    auto nmembers = (members[1] == a) ? 1 : 2;
+    for (Int i = 0; i < nmembers; ++i) {
+      auto m = members[i];
+      for (auto ab = fine->a2ab[std::size_t(m)];
+           ab < fine->a2ab[std::size_t(m + 1)]; ++ab) {
+        auto key = std::make_pair(
+            fine->ab2ranks[std::size_t(ab)], ab2coarse[std::size_t(ab)]);
+        if (key.first == rank && key.second == c) continue;
+        edges[key] += fine->ab_weights[std::size_t(ab)];
+      }
+    }
+    for (auto& edge : edges) {
+      coarse.ab2ranks.push_back(edge.first.first);
+      coarse.ab2idxs.push_back(edge.first.second);
+      coarse.ab_weights.push_back(edge.second);
+    }
+    coarse.a2ab.push_back(coarse.nedges());
+  }
+  setup_exchange(comm, &coarse);
+  return coarse;
+}
+
+/* recursive bisection of a graph held by one rank.
+   one side of each bisection is grown from a node on the
+   periphery of the subgraph, always adding the frontier node
+   that cuts the fewest edges, until it has its share of the weight */
+class Bisector {
+  Level const& graph_;
+  std::vector<I32>& parts_;
+  std::vector<Real> gains_;
+  std::vector<I8> marks_;
+
+ public:
+  Bisector(Level const& graph, std::vector<I32>& parts)
+      : graph_(graph),
+        parts_(parts),
+        gains_(std::size_t(graph.nnodes())),
+        marks_(std::size_t(graph.nnodes()), 0) {}
+  /* (nodes) all have part (first_part) when this is called */
+  void bisect(std::vector<LO> const& nodes, I32 first_part, I32 nparts) {
+    if (nparts == 1 || nodes.empty()) return;
+    auto nparts0 = nparts / 2;
+    Real total = 0.0;
+    for (auto a : nodes) total += graph_.weights[std::size_t(a)];
+    auto target = total * nparts0 / nparts;
+    for (auto a : nodes) marks_[std::size_t(a)] = 0;
+    auto seed = find_peripheral(nodes, first_part);
+    for (auto a : nodes) {
+      marks_[std::size_t(a)] = 0;
+      Real gain = 0.0;
+      for (auto ab = graph_.a2ab[std::size_t(a)];
+           ab < graph_.a2ab[std::size_t(a + 1)]; ++ab) {
+        auto b = graph_.ab2idxs[std::size_t(ab)];
+        if (parts_[std::size_t(b)] == first_part) {
+          gain -= graph_.ab_weights[std::size_t(ab)];
+        }
+      }
+      gains_[std::size_t(a)] = gain;
+    }
+    std::priority_queue<std::pair<Real, LO>> frontier;
+    frontier.push(std::make_pair(gains_[std::size_t(seed)], seed));
+    Real grown = 0.0;
+    std::size_t next = 0;
+    while (grown < target) {
+      if (frontier.empty()) {
+        /* the grown side has used up its connected component */
+        while (next < nodes.size() && marks_[std::size_t(nodes[next])]) {
+          ++next;
+        }
+        if (next == nodes.size()) break;
+        auto b = nodes[next];
+        frontier.push(std::make_pair(gains_[std::size_t(b)], b));
+      }
+      auto top = frontier.top();
+      frontier.pop();
+      auto a = top.second;
+      if (marks_[std::size_t(a)] || top.first != gains_[std::size_t(a)]) {
+        continue;
+      }
+      auto weight = graph_.weights[std::size_t(a)];
+      if (grown > 0.0 && (grown + weight - target) > (target - grown)) break;
+      marks_[std::size_t(a)] = 1;
+      grown += weight;
+      for (auto ab = graph_.a2ab[std::size_t(a)];
+           ab < graph_.a2ab[std::size_t(a + 1)]; ++ab) {
+        auto b = graph_.ab2idxs[std::size_t(ab)];
+        if (parts_[std::size_t(b)] != first_part || marks_[std::size_t(b)]) {
+          continue;
+        }
+        gains_[std::size_t(b)] += 2.0 * graph_.ab_weights[std::size_t(ab)];
+        frontier.push(std::make_pair(gains_[std::size_t(b)], b));
+      }
+    }
+    std::vector<LO> nodes0;
+    std::vector<LO> nodes1;
+    for (auto a : nodes) {
+      if (marks_[std::size_t(a)]) {
+        nodes0.push_back(a);
+      } else {
+        nodes1.push_back(a);
+        parts_[std::size_t(a)] = first_part + nparts0;
+      }
+    }
+    bisect(nodes0, first_part, nparts0);
+    bisect(nodes1, first_part + nparts0, nparts - nparts0);
+  }
+
+ private:
+  /* the last node reached by a breadth-first search */
+  LO find_peripheral(std::vector<LO> const& nodes, I32 part) {
+    std::vector<LO> queue(1, nodes[0]);
+    marks_[std::size_t(nodes[0])] = 1;
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+      auto a = queue[i];
+      for (auto ab = graph_.a2ab[std::size_t(a)];
+           ab < graph_.a2ab[std::size_t(a + 1)]; ++ab) {
+        auto b = graph_.ab2idxs[std::size_t(ab)];
+        if (parts_[std::size_t(b)] != part || marks_[std::size_t(b)]) continue;
+        marks_[std::size_t(b)] = 1;
+        queue.push_back(b);
+      }
+    }
+    return queue.back();
+  }
+};
+
+/* the coarsest graph is small, so it is gathered onto rank 0
+   to be partitioned there */
+std::vector<I32> partition_coarsest(CommPtr comm, Level const& level) {
+  auto n = level.nnodes();
+  auto m = level.nedges();
+  auto node_offset = comm->exscan(n, OMEGA_H_SUM);
+  auto edge_offset = comm->exscan(m, OMEGA_H_SUM);
+  auto nnodes = comm->allreduce(n, OMEGA_H_SUM);
+  auto nedges = comm->allreduce(m, OMEGA_H_SUM);
+  auto is_root = (comm->rank() == 0);
+  auto nodes2root = Dist(comm, Remotes(Read<I32>(n, 0), LOs(n, node_offset, 1)),
+      is_root ? nnodes : 0);
+  auto edges2root = Dist(comm, Remotes(Read<I32>(m, 0), LOs(m, edge_offset, 1)),
+      is_root ? nedges : 0);
+  std::vector<LO> globals(static_cast<std::size_t>(n));
+  std::vector<LO> degrees(static_cast<std::size_t>(n));
+  for (LO a = 0; a < n; ++a) {
+    globals[std::size_t(a)] = node_offset + a;
+    degrees[std::size_t(a)] = level.degree(a);
+  }
+  auto ab2globals = pull(level, globals, 1);
+  Level whole;
+  whole.weights = to_vector(
+      nodes2root.exch_reduce(to_read(level.weights), 1, OMEGA_H_SUM));
+  auto whole_degrees =
+      to_vector(nodes2root.exch_reduce(to_read(degrees), 1, OMEGA_H_SUM));
+  whole.ab2idxs =
+      to_vector(edges2root.exch_reduce(to_read(ab2globals), 1, OMEGA_H_SUM));
+  whole.ab_weights = to_vector(
+      edges2root.exch_reduce(to_read(level.ab_weights), 1, OMEGA_H_SUM));
+  whole.a2ab.assign(1, 0);
+  for (auto degree : whole_degrees) {
+    whole.a2ab.push_back(whole.a2ab.back() + degree);
+  }
+  std::vector<I32> whole_parts(std::size_t(whole.nnodes()), 0);
+  if (is_root) {
+    std::vector<LO> nodes(static_cast<std::size_t>(whole.nnodes()));
+    for (LO a = 0; a < whole.nnodes(); ++a) nodes[std::size_t(a)] = a;
+    Bisector(whole, whole_parts).bisect(nodes, 0, comm->size());
+  }
+  return to_vector(nodes2root.invert().exch(to_read(whole_parts), 1));
+}
+
+/* sums (values) over all ranks for each of (parts).
+   the sums are formed on the rank whose number is the part,
+   so any rank can ask about any part */
+std::vector<Real> sum_by_part(CommPtr comm, std::vector<I32> const& parts,
+    std::vector<Real> const& values) {
+  auto n = LO(parts.size());
+  auto parts2ranks = Dist(comm, Remotes(to_read(parts), LOs(n, 0)), 1);
+  auto sums = parts2ranks.exch_reduce(to_read(values), 1, OMEGA_H_SUM);
+  return to_vector(parts2ranks.invert().exch(sums, 1));
+}
+
+LO find_part(std::vector<I32> const& sorted_parts, I32 part) {
+  auto it = std::lower_bound(sorted_parts.begin(), sorted_parts.end(), part);
+  return LO(it - sorted_parts.begin());
+}
+
+/* the number of neighbors of a node in (part), out of
+   the (part, count) pairs that describe its neighbors */
+I32 count_neighbors(std::vector<I32> const& hists, std::size_t begin,
+    Int width, I32 part) {
+  for (Int i = 0; i < width; ++i) {
+    if (hists[begin + std::size_t(i * 2)] == part) {
+      return hists[begin + std::size_t(i * 2 + 1)];
+    }
+  }
+  return 0;
+}
+
+struct Move {
+  Real gain;
+  LO node;
+  I32 part;
+};
+
+/* greedy boundary refinement, all ranks at once.
+   each pass, every node adjacent to another part may move to
+   the adjacent part that gains the most, if that part has room.
+   to keep two neighbors on different ranks from trading places,
+   even passes only move nodes to higher part numbers and
+   odd passes only to lower ones.
+   nodes of overweight parts may move at a loss to lighter parts */
+void refine(CommPtr comm, Level const& level, Omega_h_Balance objective,
+    Real max_part_weight, std::vector<I32>* p_parts) {
+  auto& parts = *p_parts;
+  auto n = level.nnodes();
+  LO max_degree = 0;
+  for (LO a = 0; a < n; ++a) max_degree = max2(max_degree, level.degree(a));
+  max_degree = comm->allreduce(max_degree, OMEGA_H_MAX);
+  if (max_degree == 0) return;
+  Int const npasses = 8;
+  Int nidle = 0;
+  for (Int pass = 0; pass < npasses && nidle < 2; ++pass) {
+    auto ab2parts = pull(level, parts, 1);
+    std::vector<I32> known(parts);
+    known.insert(known.end(), ab2parts.begin(), ab2parts.end());
+    std::sort(known.begin(), known.end());
+    known.erase(std::unique(known.begin(), known.end()), known.end());
+    std::vector<Real> local_weights(known.size(), 0.0);
+    for (LO a = 0; a < n; ++a) {
+      local_weights[std::size_t(find_part(known, parts[std::size_t(a)]))] +=
+          level.weights[std::size_t(a)];
+    }
+    auto part_weights = sum_by_part(comm, known, local_weights);
+    /* the distinct parts adjacent to each node, with the
+       total weight of edges to each and how many neighbors
+       are in each */
+    std::vector<std::vector<std::pair<I32, Real>>> conns(
+        static_cast<std::size_t>(n));
+    std::vector<std::vector<I32>> counts(static_cast<std::size_t>(n));
+    for (LO a = 0; a < n; ++a) {
+      auto& conn = conns[std::size_t(a)];
+      for (auto ab = level.a2ab[std::size_t(a)];
+           ab < level.a2ab[std::size_t(a + 1)]; ++ab) {
+        auto part = ab2parts[std::size_t(ab)];
+        std::size_t i = 0;
+        while (i < conn.size() && conn[i].first != part) ++i;
+        if (i == conn.size()) {
+          conn.push_back(std::make_pair(part, 0.0));
+          counts[std::size_t(a)].push_back(0);
+        }
+        conn[i].second += level.ab_weights[std::size_t(ab)];
+        ++counts[std::size_t(a)][i];
+      }
+    }
+    std::vector<I32> ab2hists;
+    auto width = Int(max_degree);
+    if (objective == OMEGA_H_GRAPH_VOLUME) {
+      std::vector<I32> hists(std::size_t(n * width * 2), -1);
+      for (LO a = 0; a < n; ++a) {
+        auto& conn = conns[std::size_t(a)];
+        for (std::size_t i = 0; i < conn.size(); ++i) {
+          auto begin = std::size_t(a * width * 2) + i * 2;
+          hists[begin + 0] = conn[i].first;
+          hists[begin + 1] = counts[std::size_t(a)][i];
+        }
+      }
+      ab2hists = pull(level, hists, width * 2);
+    }
+    std::vector<Move> moves;
+    for (LO a = 0; a < n; ++a) {
+      auto& conn = conns[std::size_t(a)];
+      auto from = parts[std::size_t(a)];
+      auto weight = level.weights[std::size_t(a)];
+      auto from_weight = part_weights[std::size_t(find_part(known, from))];
+      auto is_heavy = (from_weight > max_part_weight);
+      Real from_conn = 0.0;
+      for (auto& c : conn) {
+        if (c.first == from) from_conn = c.second;
+      }
+      Move best = {0.0, -1, -1};
+      Real best_weight = 0.0;
+      for (auto& c : conn) {
+        auto to = c.first;
+        if (to == from) continue;
+        if (!is_heavy && ((to > from) != (pass % 2 == 0))) continue;
+        auto to_weight = part_weights[std::size_t(find_part(known, to))];
+        if (to_weight + weight > max_part_weight) continue;
+        Real gain;
+        if (objective == OMEGA_H_GRAPH_CUT) {
+          gain = c.second - from_conn;
+        } else {
+          /* this node stops being next to (to) and starts being
+             next to (from), if it has other neighbors there.
+             a neighbor stops being next to (from) if this was its
+             only neighbor there, and starts being next to (to)
+             if it had no neighbors there */
+          gain = (from_conn > 0.0) ? 0.0 : 1.0;
+          for (auto ab = level.a2ab[std::size_t(a)];
+               ab < level.a2ab[std::size_t(a + 1)]; ++ab) {
+            auto neighbor_part = ab2parts[std::size_t(ab)];
+            auto begin = std::size_t(ab * width * 2);
+            if (neighbor_part != from &&
+                count_neighbors(ab2hists, begin, width, from) == 1) {
+              gain += 1.0;
+            }
+            if (neighbor_part != to &&
+                count_neighbors(ab2hists, begin, width, to) == 0) {
+              gain -= 1.0;
+            }
+          }
+        }
+        auto helps_balance = (to_weight + weight < from_weight);
+        if (!(gain > 0.0 || (gain == 0.0 && helps_balance) ||
+                (is_heavy && helps_balance))) {
+          continue;
+        }
+        if (best.node == -1 || gain > best.gain ||
+            (gain == best.gain && to_weight < best_weight)) {
+          best.gain = gain;
+          best.node = a;
+          best.part = to;
+          best_weight = to_weight;
+        }
+      }
+      if (best.node != -1) moves.push_back(best);
+    }
+    /* so that moves decided on different ranks do not overfill
+       a part together, each rank may fill a share of the room
+       left in a part in proportion to what it asked for */
+    std::vector<Real> asked(known.size(), 0.0);
+    for (auto& move : moves) {
+      asked[std::size_t(find_part(known, move.part))] +=
+          level.weights[std::size_t(move.node)];
+    }
+    auto total_asked = sum_by_part(comm, known, asked);
+    std::stable_sort(moves.begin(), moves.end(),
+        [](Move const& a, Move const& b) { return a.gain > b.gain; });
+    std::vector<Real> granted(known.size(), 0.0);
+    LO nmoved = 0;
+    for (auto& move : moves) {
+      auto i = std::size_t(find_part(known, move.part));
+      auto room = max_part_weight - part_weights[i];
+      auto share = (total_asked[i] <= room)
+                       ? asked[i]
+                       : (room * asked[i] / total_asked[i]);
+      auto weight = level.weights[std::size_t(move.node)];
+      if (granted[i] + weight > share) continue;
+      granted[i] += weight;
+      parts[std::size_t(move.node)] = move.part;
+      ++nmoved;
+    }
+    if (comm->allreduce(GO(nmoved), OMEGA_H_SUM) == 0) {
+      ++nidle;
+    } else {
+      nidle = 0;
+    }
+  }
+}
+
+}  // end anonymous namespace
+
+Read<I32> partition(
+    DistGraph graph, Omega_h_Balance objective, Real tolerance) {
+  OMEGA_H_CHECK(
+      objective == OMEGA_H_GRAPH_CUT || objective == OMEGA_H_GRAPH_VOLUME);
+  auto comm = graph.comm;
+  auto nparts = comm->size();
+  std::vector<Level> levels(1);
+  levels[0].weights = to_vector(graph.weights);
+  levels[0].a2ab = to_vector(graph.a2ab);
+  levels[0].ab2ranks = to_vector(graph.ab2b.ranks);
+  levels[0].ab2idxs = to_vector(graph.ab2b.idxs);
+  levels[0].ab_weights = to_vector(graph.ab_weights);
+  setup_exchange(comm, &levels[0]);
+  auto total_weight = get_sum(comm, graph.weights);
+  auto avg_weight = total_weight / nparts;
+  /* enough coarse nodes per part that the bisection can
+     balance them */
+  auto coarsest_nnodes = GO(nparts) * 32;
+  auto max_node_weight = 1.5 * total_weight / Real(coarsest_nnodes);
+  auto nnodes = comm->allreduce(GO(levels[0].nnodes()), OMEGA_H_SUM);
+  while (nnodes > coarsest_nnodes) {
+    auto coarse = coarsen(comm, &levels.back(), max_node_weight);
+    auto coarse_nnodes = comm->allreduce(GO(coarse.nnodes()), OMEGA_H_SUM);
+    levels.push_back(std::move(coarse));
+    /* with matching confined to each rank, coarsening stalls
+       once each rank has few nodes left */
+    if (Real(coarse_nnodes) > 0.9 * Real(nnodes)) break;
+    nnodes = coarse_nnodes;
+  }
+  auto parts = partition_coarsest(comm, levels.back());
+  for (auto i = levels.size(); i-- > 0;) {
+    auto& level = levels[i];
+    if (i + 1 < levels.size()) {
+      std::vector<I32> fine_parts(
+          static_cast<std::size_t>(level.nnodes()));
+      for (LO a = 0; a < level.nnodes(); ++a) {
+        fine_parts[std::size_t(a)] =
+            parts[std::size_t(level.fine2coarse[std::size_t(a)])];
+      }
+      parts.swap(fine_parts);
+    }
+    Real heaviest = 0.0;
+    for (auto weight : level.weights) heaviest = max2(heaviest, weight);
+    heaviest = comm->allreduce(heaviest, OMEGA_H_MAX);
+    auto max_part_weight =
+        max2(tolerance * avg_weight, avg_weight + heaviest);
+    refine(comm, level, objective, max_part_weight, &parts);
+  }
+  return to_read(parts);
+}
+
+}  // namespace multilevel
+
+}  // end namespace Omega_h
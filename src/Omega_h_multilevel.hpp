@@ -0,0 +1,51 @@
+#ifndef OMEGA_H_MULTILEVEL_HPP
+#define OMEGA_H_MULTILEVEL_HPP
+
+#include "Omega_h_remotes.hpp"
+
+namespace Omega_h {
+
+class Mesh;
+
+namespace multilevel {
+
+/* a graph whose nodes are distributed over the ranks of (comm).
+   the edges of local node (a) are [a2ab[a], a2ab[a + 1]),
+   edge (ab) leads to node (ab2b.idxs[ab]) of rank (ab2b.ranks[ab])
+   and has weight (ab_weights[ab]).
+   each edge is stored once from each of its ends with the
+   same weight, and no node has an edge to itself. */
+struct DistGraph {
+  CommPtr comm;
+  Reals weights;
+  LOs a2ab;
+  Remotes ab2b;
+  Reals ab_weights;
+};
+
+/* the element dual graph of an element-based partitioned mesh,
+   including the edges between elements on different ranks,
+   with unit edge weights and the given element weights */
+DistGraph get_elem_dual(Mesh* mesh, Reals elem_weights);
+
+/* assigns each local node to one of comm->size() parts,
+   by heavy-edge coarsening, recursive bisection of the coarsest
+   graph, and greedy refinement of part boundaries as the
+   partition is projected back to the original graph.
+   (objective) is OMEGA_H_GRAPH_CUT to minimize the weight of
+   edges between parts or OMEGA_H_GRAPH_VOLUME to minimize,
+   over all nodes, the number of other parts adjacent to each.
+   parts are kept under (tolerance) times the average part weight
+   when the node weights allow it.
+   all of this runs serially in host memory on each rank, and the
+   coarsest graph, with at least 32 nodes per part and more when
+   coarsening stalls, is gathered onto rank 0 and bisected there.
+   its memory and time on rank 0 thus grow linearly with the number
+   of ranks, which limits this to moderate rank counts */
+Read<I32> partition(DistGraph graph, Omega_h_Balance objective, Real tolerance);
+
+}  // namespace multilevel
+
+}  // end namespace Omega_h
+
+#endif
@@ -0,0 +1,93 @@
+#include "Omega_h_pool.hpp"
+
+#include <new>
+
+#include "Omega_h_c.h"
+
+namespace Omega_h {
+
+enum { POOL_MIN_BYTES_LOG2 = 6 };  // 64 bytes
+
+Pool::Pool() : stats_() {}
+
+Pool::~Pool() { release(); }
+
+int Pool::size_class(std::size_t nbytes) {
+  if (nbytes <= (std::size_t(1) << POOL_MIN_BYTES_LOG2)) return 0;
+  auto n = nbytes - 1;
+  int e = 0;
+  while ((n >> e) > 1) ++e;
+  /* e is now floor(log2(nbytes - 1)) >= POOL_MIN_BYTES_LOG2,
+     pick one of four sub-classes between 2^e and 2^(e+1) */
+  auto sub = int((n >> (e - 2)) & 3);
+  return (e - POOL_MIN_BYTES_LOG2) * 4 + sub + 1;
+}
+
+std::size_t Pool::class_bytes(int size_class) {
+  if (size_class == 0) return std::size_t(1) << POOL_MIN_BYTES_LOG2;
+  auto e = (size_class - 1) / 4 + POOL_MIN_BYTES_LOG2;
+  auto sub = (size_class - 1) % 4;
+  return std::size_t(4 + sub + 1) << (e - 2);
+}
+
+void* Pool::allocate(std::size_t nbytes) {
+  auto c = size_class(nbytes);
+  auto cbytes = class_bytes(c);
+  OMEGA_H_CHECK(cbytes >= nbytes);
+  void* ptr = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.nallocs;
+    stats_.used_bytes += cbytes;
+    if (stats_.used_bytes > stats_.max_used_bytes) {
+      stats_.max_used_bytes = stats_.used_bytes;
+    }
+    if (std::size_t(c) < free_lists_.size() &&
+        !free_lists_[std::size_t(c)].empty()) {
+      auto& list = free_lists_[std::size_t(c)];
+      ptr = list.back();
+      list.pop_back();
+      stats_.cached_bytes -= cbytes;
+      ++stats_.nreused;
+      return ptr;
+    }
+  }
+  return ::operator new(cbytes);
+}
+
+void Pool::deallocate(void* ptr, std::size_t nbytes) {
+  auto c = size_class(nbytes);
+  auto cbytes = class_bytes(c);
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.used_bytes -= cbytes;
+  /* never cache more than the peak amount ever in use,
+     so the pool at most doubles the memory footprint */
+  if (stats_.cached_bytes + cbytes > stats_.max_used_bytes) {
+    ::operator delete(ptr);
+    return;
+  }
+  if (std::size_t(c) >= free_lists_.size()) {
+    free_lists_.resize(std::size_t(c) + 1);
+  }
+  free_lists_[std::size_t(c)].push_back(ptr);
+  stats_.cached_bytes += cbytes;
+  if (stats_.cached_bytes > stats_.max_cached_bytes) {
+    stats_.max_cached_bytes = stats_.cached_bytes;
+  }
+}
+
+void Pool::release() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& list : free_lists_) {
+    for (auto ptr : list) ::operator delete(ptr);
+    list.clear();
+  }
+  stats_.cached_bytes = 0;
+}
+
+PoolStats Pool::stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+}  // end namespace Omega_h
@@ -0,0 +1,59 @@
+#ifndef OMEGA_H_POOL_HPP
+#define OMEGA_H_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Omega_h {
+
+/* a caching allocator for array storage.
+   adaptation allocates and frees many short-lived arrays
+   whose sizes recur from one operation to the next
+   (e.g. one value per vertex, per edge, per element).
+   freed blocks are kept in per-size-class free lists
+   and handed back out to the next request of the same class,
+   avoiding both allocator time and fresh page faults.
+   size classes are spaced four per power of two,
+   so at most 25% of a block is wasted by rounding.
+   the cache never holds more than the peak number of bytes
+   in use at once, so the pool at most doubles the footprint. */
+
+struct PoolStats {
+  std::size_t nallocs;      // total number of allocate() calls
+  std::size_t nreused;      // allocate() calls served from a free list
+  std::size_t cached_bytes; // bytes currently held in free lists
+  std::size_t max_cached_bytes;
+  std::size_t used_bytes;   // bytes currently handed out (after rounding)
+  std::size_t max_used_bytes;
+};
+
+class Pool {
+ public:
+  Pool();
+  ~Pool();
+  Pool(Pool const&) = delete;
+  Pool& operator=(Pool const&) = delete;
+  void* allocate(std::size_t nbytes);
+  void deallocate(void* ptr, std::size_t nbytes);
+  /* returns all cached blocks to the system allocator */
+  void release();
+  PoolStats stats();
+  static int size_class(std::size_t nbytes);
+  static std::size_t class_bytes(int size_class);
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::vector<void*>> free_lists_;
+  PoolStats stats_;
+};
+
+typedef std::shared_ptr<Pool> PoolPtr;
+
+/* the pool of the current Library, used by Write<T> */
+PoolPtr get_array_pool();
+
+}  // end namespace Omega_h
+
+#endif
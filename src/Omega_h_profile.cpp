@@ -0,0 +1,407 @@
+#include "Omega_h_profile.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include "Omega_h_comm.hpp"
+#include "Omega_h_timer.hpp"
+
+namespace Omega_h {
+
+namespace profile {
+
+struct Frame {
+  std::string name;
+  int parent;
+  std::map<std::string, int> children;
+  std::size_t calls;
+  Real time;
+  std::size_t bytes;
+  std::size_t comm_calls;
+  std::size_t msgs;
+  std::size_t comm_bytes;
+  std::size_t max_neighbors;
+  Real wait;
+};
+
+static Frame make_frame(std::string const& name, int parent) {
+  Frame f;
+  f.name = name;
+  f.parent = parent;
+  f.calls = 0;
+  f.time = 0.0;
+  f.bytes = 0;
+  f.comm_calls = 0;
+  f.msgs = 0;
+  f.comm_bytes = 0;
+  f.max_neighbors = 0;
+  f.wait = 0.0;
+  return f;
+}
+
+class History {
+ public:
+  History();
+  void push(std::string const& name);
+  void pop();
+  void add_bytes(std::size_t bytes);
+  void add_comm(std::size_t nmsgs, std::size_t nbytes, std::size_t nneighbors);
+  void add_wait(Real seconds);
+  std::vector<Frame> frames;
+  std::vector<int> stack;
+  std::vector<Now> starts;
+};
+
+History* global_singleton_history = nullptr;
+
+History::History() {
+  Frame root = make_frame("total", -1);
+  root.calls = 1;
+  frames.push_back(root);
+  stack.push_back(0);
+  starts.push_back(now());
+}
+
+void History::push(std::string const& name) {
+  auto parent = stack.back();
+  auto& siblings = frames[std::size_t(parent)].children;
+  auto key = name.empty() ? std::string("(unnamed)") : name;
+  auto it = siblings.find(key);
+  int frame;
+  if (it == siblings.end()) {
+    frame = int(frames.size());
+    siblings[key] = frame;
+    frames.push_back(make_frame(key, parent));
+  } else {
+    frame = it->second;
+  }
+  ++frames[std::size_t(frame)].calls;
+  stack.push_back(frame);
+  starts.push_back(now());
+}
+
+void History::pop() {
+  /* an unmatched end_code() should not unwind past the root */
+  if (stack.size() == 1) return;
+  auto t = now() - starts.back();
+  frames[std::size_t(stack.back())].time += t;
+  stack.pop_back();
+  starts.pop_back();
+}
+
+void History::add_bytes(std::size_t bytes) {
+  frames[std::size_t(stack.back())].bytes += bytes;
+}
+
+void History::add_comm(
+    std::size_t nmsgs, std::size_t nbytes, std::size_t nneighbors) {
+  auto& f = frames[std::size_t(stack.back())];
+  ++f.comm_calls;
+  f.msgs += nmsgs;
+  f.comm_bytes += nbytes;
+  f.max_neighbors = std::max(f.max_neighbors, nneighbors);
+}
+
+void History::add_wait(Real seconds) {
+  frames[std::size_t(stack.back())].wait += seconds;
+}
+
+void simple_push(std::string const& name) {
+  global_singleton_history->push(name);
+}
+
+void simple_pop() { global_singleton_history->pop(); }
+
+void simple_add_bytes(std::size_t bytes) {
+  global_singleton_history->add_bytes(bytes);
+}
+
+void simple_add_comm(
+    std::size_t nmsgs, std::size_t nbytes, std::size_t nneighbors) {
+  global_singleton_history->add_comm(nmsgs, nbytes, nneighbors);
+}
+
+void simple_add_wait(double seconds) {
+  global_singleton_history->add_wait(seconds);
+}
+
+void enable() {
+  if (!global_singleton_history) global_singleton_history = new History();
+}
+
+struct Stat {
+  Real min;
+  Real max;
+  Real avg;
+};
+
+struct ReducedFrame {
+  std::string name;
+  std::vector<int> children;
+  I64 calls;
+  Stat inclusive;
+  Stat exclusive;
+  Stat bytes;
+  I64 comm_calls;
+  Stat msgs;
+  Stat comm_bytes;
+  Stat neighbors;
+  Stat wait;
+  /* whether this region or any region nested in it
+     sent messages to other ranks */
+  bool communicates;
+};
+
+static Stat reduce_stat(CommPtr comm, Real x) {
+  Stat s;
+  s.min = comm->allreduce(x, OMEGA_H_MIN);
+  s.max = comm->allreduce(x, OMEGA_H_MAX);
+  s.avg = comm->allreduce(x, OMEGA_H_SUM) / comm->size();
+  return s;
+}
+
+static std::string serialize_paths(History const& h) {
+  std::stringstream ss;
+  for (std::size_t i = 1; i < h.frames.size(); ++i) {
+    std::vector<std::string> path;
+    for (auto f = int(i); f > 0; f = h.frames[std::size_t(f)].parent) {
+      path.push_back(h.frames[std::size_t(f)].name);
+    }
+    std::reverse(path.begin(), path.end());
+    for (std::size_t j = 0; j < path.size(); ++j) {
+      if (j) ss << '\t';
+      ss << path[j];
+    }
+    ss << '\n';
+  }
+  return ss.str();
+}
+
+/* returns the local frame with the given tab-separated path,
+   or -1 if this rank never entered that region */
+static int find_path(History const& h, std::string const& path) {
+  int f = 0;
+  std::stringstream ss(path);
+  std::string name;
+  while (std::getline(ss, name, '\t')) {
+    auto& children = h.frames[std::size_t(f)].children;
+    auto it = children.find(name);
+    if (it == children.end()) return -1;
+    f = it->second;
+  }
+  return f;
+}
+
+static std::vector<ReducedFrame> reduce_history(
+    History const& h, CommPtr comm) {
+  std::vector<Real> child_time(h.frames.size(), 0.0);
+  for (std::size_t i = 1; i < h.frames.size(); ++i) {
+    child_time[std::size_t(h.frames[i].parent)] += h.frames[i].time;
+  }
+  auto paths = serialize_paths(h);
+  comm->bcast_string(paths);
+  std::vector<std::string> path_list;
+  path_list.push_back("");
+  {
+    std::stringstream ss(paths);
+    std::string line;
+    while (std::getline(ss, line)) path_list.push_back(line);
+  }
+  std::vector<ReducedFrame> out(path_list.size());
+  for (std::size_t i = 0; i < path_list.size(); ++i) {
+    auto f = (i == 0) ? 0 : find_path(h, path_list[i]);
+    Real time = 0.0;
+    Real excl = 0.0;
+    Real bytes = 0.0;
+    I64 calls = 0;
+    I64 comm_calls = 0;
+    Real msgs = 0.0;
+    Real comm_bytes = 0.0;
+    Real neighbors = 0.0;
+    Real wait = 0.0;
+    if (f >= 0) {
+      auto& frame = h.frames[std::size_t(f)];
+      time = frame.time;
+      excl = frame.time - child_time[std::size_t(f)];
+      bytes = Real(frame.bytes);
+      calls = I64(frame.calls);
+      comm_calls = I64(frame.comm_calls);
+      msgs = Real(frame.msgs);
+      comm_bytes = Real(frame.comm_bytes);
+      neighbors = Real(frame.max_neighbors);
+      wait = frame.wait;
+    }
+    auto& r = out[i];
+    auto slash = path_list[i].find_last_of('\t');
+    r.name = (i == 0) ? std::string("total")
+                      : (slash == std::string::npos)
+                            ? path_list[i]
+                            : path_list[i].substr(slash + 1);
+    r.calls = comm->allreduce(calls, OMEGA_H_MAX);
+    r.inclusive = reduce_stat(comm, time);
+    r.exclusive = reduce_stat(comm, excl);
+    r.bytes = reduce_stat(comm, bytes);
+    r.comm_calls = comm->allreduce(comm_calls, OMEGA_H_MAX);
+    r.msgs = reduce_stat(comm, msgs);
+    r.comm_bytes = reduce_stat(comm, comm_bytes);
+    r.neighbors = reduce_stat(comm, neighbors);
+    r.wait = reduce_stat(comm, wait);
+    r.communicates = (r.msgs.max > 0.0);
+  }
+  /* rank zero's frames were serialized in creation order,
+     in which every parent precedes its children */
+  for (std::size_t i = 1; i < path_list.size(); ++i) {
+    auto slash = path_list[i].find_last_of('\t');
+    auto parent_path = (slash == std::string::npos)
+                           ? std::string()
+                           : path_list[i].substr(0, slash);
+    auto parent = std::size_t(
+        std::find(path_list.begin(), path_list.begin() + long(i),
+            parent_path) -
+        path_list.begin());
+    out[parent].children.push_back(int(i));
+  }
+  /* children come after their parents, so one backwards pass
+     marks every region whose subtree communicates */
+  for (std::size_t i = path_list.size(); i-- > 0;) {
+    for (auto c : out[i].children) {
+      if (out[std::size_t(c)].communicates) out[i].communicates = true;
+    }
+  }
+  for (auto& r : out) {
+    std::stable_sort(r.children.begin(), r.children.end(), [&](int a, int b) {
+      return out[std::size_t(a)].inclusive.avg >
+             out[std::size_t(b)].inclusive.avg;
+    });
+  }
+  return out;
+}
+
+static void print_frame(std::ostream& os,
+    std::vector<ReducedFrame> const& frames, int f, int depth) {
+  auto& r = frames[std::size_t(f)];
+  os << std::setw(10) << r.calls << std::setw(12) << r.inclusive.avg
+     << std::setw(12) << r.inclusive.min << std::setw(12) << r.inclusive.max
+     << std::setw(12) << r.exclusive.avg << std::setw(14)
+     << std::size_t(r.bytes.max) << "  " << std::string(std::size_t(depth * 2), ' ')
+     << r.name << '\n';
+  for (auto c : r.children) print_frame(os, frames, c, depth + 1);
+}
+
+/* the ratio of the maximum to the average over ranks,
+   1 being perfectly balanced */
+static Real imbalance(Stat s) { return (s.avg > 0.0) ? (s.max / s.avg) : 1.0; }
+
+static void print_comm_frame(std::ostream& os,
+    std::vector<ReducedFrame> const& frames, int f, int depth) {
+  auto& r = frames[std::size_t(f)];
+  if (!r.communicates) return;
+  os << std::setw(10) << r.comm_calls << std::setw(12) << r.msgs.avg
+     << std::setw(12) << std::size_t(r.msgs.max) << std::setw(14)
+     << r.comm_bytes.avg << std::setw(14) << std::size_t(r.comm_bytes.max)
+     << std::setw(10) << imbalance(r.comm_bytes) << std::setw(6)
+     << std::size_t(r.neighbors.max)
+     << std::setw(12) << r.wait.avg << std::setw(12) << r.wait.max << "  "
+     << std::string(std::size_t(depth * 2), ' ') << r.name << '\n';
+  for (auto c : r.children) print_comm_frame(os, frames, c, depth + 1);
+}
+
+static std::string escape_json(std::string const& s) {
+  std::string out;
+  for (auto c : s) {
+    if (c == '"' || c == '\\') out.push_back('\\');
+    out.push_back(c);
+  }
+  return out;
+}
+
+static void write_stat_json(std::ostream& os, char const* name, Stat s) {
+  os << '"' << name << "\": {\"min\": " << s.min << ", \"max\": " << s.max
+     << ", \"avg\": " << s.avg << '}';
+}
+
+static void write_frame_json(std::ostream& os,
+    std::vector<ReducedFrame> const& frames, int f, int depth) {
+  auto& r = frames[std::size_t(f)];
+  std::string indent(std::size_t(depth * 2), ' ');
+  os << indent << "{\"name\": \"" << escape_json(r.name) << "\", ";
+  os << "\"calls\": " << r.calls << ", ";
+  write_stat_json(os, "inclusive", r.inclusive);
+  os << ", ";
+  write_stat_json(os, "exclusive", r.exclusive);
+  os << ", ";
+  write_stat_json(os, "bytes", r.bytes);
+  if (r.communicates) {
+    os << ", \"comm_calls\": " << r.comm_calls << ", ";
+    write_stat_json(os, "msgs", r.msgs);
+    os << ", ";
+    write_stat_json(os, "comm_bytes", r.comm_bytes);
+    os << ", ";
+    write_stat_json(os, "neighbors", r.neighbors);
+    os << ", ";
+    write_stat_json(os, "wait", r.wait);
+  }
+  os << ", \"children\": [";
+  if (!r.children.empty()) {
+    os << '\n';
+    for (std::size_t i = 0; i < r.children.size(); ++i) {
+      if (i) os << ",\n";
+      write_frame_json(os, frames, r.children[i], depth + 1);
+    }
+    os << '\n' << indent;
+  }
+  os << "]}";
+}
+
+void finalize(CommPtr comm, bool should_print, std::string const& json_path) {
+  auto h = global_singleton_history;
+  if (!h) return;
+  /* stop recording before communicating, the reduction
+     below should not show up in its own results */
+  global_singleton_history = nullptr;
+  while (h->stack.size() > 1) h->pop();
+  h->frames[0].time = now() - h->starts[0];
+  auto frames = reduce_history(*h, comm);
+  delete h;
+  if (comm->rank() != 0) return;
+  if (should_print) {
+    std::cout << "Omega_h profile over " << comm->size()
+              << " ranks, times in seconds:\n";
+    std::cout << std::setw(10) << "calls" << std::setw(12) << "avg incl"
+              << std::setw(12) << "min incl" << std::setw(12) << "max incl"
+              << std::setw(12) << "avg excl" << std::setw(14) << "max bytes"
+              << "  region\n";
+    auto flags = std::cout.flags();
+    std::cout << std::fixed << std::setprecision(6);
+    print_frame(std::cout, frames, 0, 0);
+    if (frames[0].communicates) {
+      std::cout << "Omega_h communication by region, per rank "
+                   "(imbalance is max / avg bytes):\n";
+      std::cout << std::setw(10) << "ops" << std::setw(12) << "avg msgs"
+                << std::setw(12) << "max msgs" << std::setw(14) << "avg bytes"
+                << std::setw(14) << "max bytes" << std::setw(10) << "imbal"
+                << std::setw(6) << "nbrs" << std::setw(12) << "avg wait"
+                << std::setw(12) << "max wait"
+                << "  region\n";
+      print_comm_frame(std::cout, frames, 0, 0);
+    }
+    std::cout.flags(flags);
+  }
+  if (!json_path.empty()) {
+    std::ofstream file(json_path.c_str());
+    OMEGA_H_CHECK(file.is_open());
+    file << std::scientific << std::setprecision(9);
+    file << "{\"nranks\": " << comm->size() << ", \"tree\":\n";
+    write_frame_json(file, frames, 0, 1);
+    file << "\n}\n";
+  }
+}
+
+}  // namespace profile
+
+}  // end namespace Omega_h
@@ -0,0 +1,52 @@
+#ifndef OMEGA_H_PROFILE_HPP
+#define OMEGA_H_PROFILE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Omega_h {
+
+class Comm;
+
+namespace profile {
+
+/* a hierarchical profiler fed by begin_code() and end_code().
+   each distinct path of nested region names from the root
+   becomes one node of a call tree which accumulates the
+   number of calls, the wall time spent inside the region
+   (inclusive of nested regions) and the bytes of arrays
+   allocated while the region was the innermost one.
+   Comm also reports to it the messages, bytes and neighbors
+   of each communication and the time spent waiting on them,
+   so that communication-bound regions and their imbalance
+   across ranks show up in the summary.
+   it is enabled by the Library for --osh-time or --osh-time-json */
+
+class History;
+
+extern History* global_singleton_history;
+
+void simple_push(std::string const& name);
+void simple_pop();
+void simple_add_bytes(std::size_t bytes);
+/* one communication operation which sent (nmsgs) messages
+   carrying (nbytes) to other ranks, out of (nneighbors) ranks
+   it could have sent to. a collective is one message per rank */
+void simple_add_comm(
+    std::size_t nmsgs, std::size_t nbytes, std::size_t nneighbors);
+void simple_add_wait(double seconds);
+
+void enable();
+
+/* stops profiling, reduces the call tree across the ranks of comm
+   (matching regions by their path on rank zero), and if requested
+   prints a table sorted by time on rank zero and writes it as JSON */
+void finalize(std::shared_ptr<Comm> comm, bool should_print,
+    std::string const& json_path);
+
+}  // namespace profile
+
+}  // end namespace Omega_h
+
+#endif
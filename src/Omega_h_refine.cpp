@@ -5,10 +5,12 @@
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_indset.hpp"
 #include "Omega_h_map.hpp"
+#include "Omega_h_mark.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_modify.hpp"
 #include "Omega_h_refine_qualities.hpp"
 #include "Omega_h_refine_topology.hpp"
+#include "Omega_h_shape.hpp"
 #include "Omega_h_transfer.hpp"
 
 namespace Omega_h {
@@ -90,9 +92,16 @@ static bool refine(Mesh* mesh, AdaptOpts const& opts) {
 
 bool refine_by_size(Mesh* mesh, AdaptOpts const& opts) {
   auto comm = mesh->comm();
-  auto lengths = mesh->ask_lengths();
-  auto edge_is_cand = each_gt(lengths, opts.max_length_desired);
-  if (get_max(comm, edge_is_cand) != 1) return false;
+  auto dirty_edges =
+      collect_dirty(mesh, EDGE, REFINE_DIRTY, opts.ndirty_layers);
+  clean_dirty(mesh, REFINE_DIRTY);
+  auto lengths = mesh->has_tag(EDGE, "length")
+                     ? unmap(dirty_edges, mesh->ask_lengths(), 1)
+                     : measure_edges_metric(mesh, dirty_edges);
+  auto dirty_edge_is_cand = each_gt(lengths, opts.max_length_desired);
+  if (get_max(comm, dirty_edge_is_cand) != 1) return false;
+  auto edge_is_cand =
+      map_onto(dirty_edge_is_cand, dirty_edges, mesh->nedges(), I8(0), 1);
   mesh->add_tag(EDGE, "candidate", 1, edge_is_cand);
   return refine(mesh, opts);
 }
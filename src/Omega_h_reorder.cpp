@@ -1,5 +1,9 @@
+#include <algorithm>
+#include <vector>
+
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_hilbert.hpp"
+#include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_sort.hpp"
@@ -48,17 +52,97 @@ static void reorder_mesh_by_verts(Mesh* mesh, LOs new_verts2old_verts) {
   unmap_mesh(mesh, new_ents2old_ents);
 }
 
-void reorder_by_hilbert(Mesh* mesh) {
-  OMEGA_H_CHECK(mesh->comm()->size() == 1);
-  auto coords = mesh->coords();
-  LOs new_verts2old_verts = hilbert::sort_coords(coords, mesh->dim());
+/* each rank reorders only its local entities, whose tags follow them.
+   in parallel that includes "global", so global numbering does not
+   depend on the reordering. a serial mesh is renumbered 0 to N-1 in
+   the new order, which build_box() relies on */
+static void reorder_mesh_and_globals(Mesh* mesh, LOs new_verts2old_verts) {
   reorder_mesh_by_verts(mesh, new_verts2old_verts);
+  if (mesh->comm()->size() > 1) return;
   for (Int ent_dim = 0; ent_dim <= mesh->dim(); ++ent_dim) {
     mesh->remove_tag(ent_dim, "global");
     mesh->add_tag(ent_dim, "global", 1, GOs(mesh->nents(ent_dim), 0, 1));
   }
 }
 
+void reorder_by_hilbert(Mesh* mesh) {
+  auto coords = mesh->coords();
+  LOs new_verts2old_verts = hilbert::sort_coords(coords, mesh->dim());
+  reorder_mesh_and_globals(mesh, new_verts2old_verts);
+}
+
+/* Reverse Cuthill-McKee ordering of the vertex graph.
+   Breadth-first search is inherently sequential, so this
+   runs on the host. Each connected component is started
+   from its unvisited vertex of lowest degree, a cheap
+   approximation of a peripheral vertex. */
+static LOs rcm_order_verts(Mesh* mesh) {
+  auto star = mesh->ask_star(VERT);
+  auto v2vv = HostRead<LO>(star.a2ab);
+  auto vv2v = HostRead<LO>(star.ab2b);
+  auto nverts = mesh->nverts();
+  std::vector<LO> degrees(static_cast<std::size_t>(nverts));
+  for (LO v = 0; v < nverts; ++v) {
+    degrees[std::size_t(v)] = v2vv[v + 1] - v2vv[v];
+  }
+  auto by_degree = [&](LO a, LO b) {
+    return degrees[std::size_t(a)] < degrees[std::size_t(b)];
+  };
+  std::vector<LO> starts(static_cast<std::size_t>(nverts));
+  for (LO v = 0; v < nverts; ++v) starts[std::size_t(v)] = v;
+  std::stable_sort(starts.begin(), starts.end(), by_degree);
+  std::vector<I8> visited(std::size_t(nverts), 0);
+  std::vector<LO> order;
+  order.reserve(std::size_t(nverts));
+  std::vector<LO> adj;
+  std::size_t next_start = 0;
+  std::size_t head = 0;
+  while (order.size() < std::size_t(nverts)) {
+    if (head == order.size()) {
+      while (visited[std::size_t(starts[next_start])]) ++next_start;
+      auto start = starts[next_start];
+      visited[std::size_t(start)] = 1;
+      order.push_back(start);
+    }
+    auto v = order[head++];
+    adj.clear();
+    for (auto vv = v2vv[v]; vv < v2vv[v + 1]; ++vv) {
+      auto v2 = vv2v[vv];
+      if (visited[std::size_t(v2)]) continue;
+      visited[std::size_t(v2)] = 1;
+      adj.push_back(v2);
+    }
+    std::stable_sort(adj.begin(), adj.end(), by_degree);
+    order.insert(order.end(), adj.begin(), adj.end());
+  }
+  HostWrite<LO> new_verts2old_verts(nverts);
+  for (LO i = 0; i < nverts; ++i) {
+    new_verts2old_verts[i] = order[std::size_t(nverts - 1 - i)];
+  }
+  return new_verts2old_verts.write();
+}
+
+void reorder_by_rcm(Mesh* mesh) {
+  reorder_mesh_and_globals(mesh, rcm_order_verts(mesh));
+}
+
+Real measure_locality(Mesh* mesh) {
+  auto ev2v = mesh->ask_verts_of(EDGE);
+  auto nedges = mesh->nedges();
+  auto comm = mesh->comm();
+  auto nglobal_edges = comm->allreduce(GO(nedges), OMEGA_H_SUM);
+  if (nglobal_edges == 0) return 1.0;
+  Write<I8> is_local(nedges);
+  auto f = OMEGA_H_LAMBDA(LO e) {
+    auto gap = ev2v[e * 2 + 1] - ev2v[e * 2 + 0];
+    if (gap < 0) gap = -gap;
+    is_local[e] = (gap < LOCALITY_WINDOW);
+  };
+  parallel_for(nedges, f, "measure_locality");
+  auto nlocal = comm->allreduce(GO(get_sum(Read<I8>(is_local))), OMEGA_H_SUM);
+  return Real(nlocal) / Real(nglobal_edges);
+}
+
 void reorder_by_globals(Mesh* mesh) {
   LOs new_ents2old_ents[4];
   for (Int ent_dim = 0; ent_dim <= mesh->dim(); ++ent_dim) {
@@ -1,6 +1,8 @@
 #include "Omega_h_sort.hpp"
 
 #include <algorithm>
+#include <climits>
+#include <type_traits>
 #include <vector>
 
 #if defined(OMEGA_H_USE_CUDA)
@@ -49,8 +51,7 @@ struct CompareKeySets {
 };
 
 template <Int N, typename T>
-static LOs sort_by_keys_tmpl(Read<T> keys) {
-  begin_code("sort_by_keys");
+static LOs comparison_sort_by_keys(Read<T> keys) {
   auto n = divide_no_remainder(keys.size(), N);
   Write<LO> perm(n, 0, 1);
   LO* begin = perm.data();
@@ -58,24 +59,183 @@ static LOs sort_by_keys_tmpl(Read<T> keys) {
   T const* keyptr = keys.data();
   parallel_sort<LO, CompareKeySets<T, N>>(
       begin, end, CompareKeySets<T, N>(keyptr));
+  return perm;
+}
+
+#ifndef OMEGA_H_USE_CUDA
+
+/* LSD radix sort of the permutation. The integers of a key
+   are visited from last to first, and each integer from its
+   lowest byte to its highest.
+   Every integer is first shifted by the minimum of its column,
+   so negative keys are handled and bytes above the spread of
+   the values are never visited.
+   Each pass moves (value, index) pairs in the order of a
+   counting sort, which is stable, so the final permutation
+   is identical to that of the comparison sort. */
+
+enum { RADIX_BITS = 8, RADIX = 1 << RADIX_BITS };
+
+/* below this many keys per thread, extra threads only add overhead */
+enum { RADIX_MIN_PER_THREAD = 1 << 16 };
+
+static int radix_nthreads(LO n) {
+#ifdef OMEGA_H_USE_OPENMP
+  auto max_threads = omp_get_max_threads();
+  auto wanted = int(n / RADIX_MIN_PER_THREAD);
+  return max2(1, min2(max_threads, wanted));
+#else
+  (void)n;
+  return 1;
+#endif
+}
+
+static LO radix_block_begin(LO n, int thread, int nthreads) {
+  return LO((I64(n) * thread) / nthreads);
+}
+
+/* one counting-sort pass on the digit at (shift).
+   returns false without moving anything if all keys share
+   the same digit, in which case the pass would be the identity */
+template <typename U>
+static bool radix_pass(LO n, int nthreads, Int shift, U const* vals_in,
+    LO const* perm_in, U* vals_out, LO* perm_out) {
+  std::vector<LO> counts(std::size_t(nthreads * RADIX), 0);
+  auto count = [&](int t) {
+    auto c = counts.data() + t * RADIX;
+    auto e = radix_block_begin(n, t + 1, nthreads);
+    for (auto i = radix_block_begin(n, t, nthreads); i < e; ++i) {
+      ++c[(vals_in[i] >> shift) & U(RADIX - 1)];
+    }
+  };
+#ifdef OMEGA_H_USE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+  for (int t = 0; t < nthreads; ++t) count(t);
+  /* offsets are laid out by digit first and thread second,
+     so each thread scatters its block behind those of
+     the threads before it and stability is preserved */
+  LO sum = 0;
+  for (int d = 0; d < RADIX; ++d) {
+    auto digit_start = sum;
+    for (int t = 0; t < nthreads; ++t) {
+      auto& c = counts[std::size_t(t * RADIX + d)];
+      auto tmp = c;
+      c = sum;
+      sum += tmp;
+    }
+    if (sum - digit_start == n) return false;
+  }
+  auto scatter = [&](int t) {
+    auto c = counts.data() + t * RADIX;
+    auto e = radix_block_begin(n, t + 1, nthreads);
+    for (auto i = radix_block_begin(n, t, nthreads); i < e; ++i) {
+      auto o = c[(vals_in[i] >> shift) & U(RADIX - 1)]++;
+      vals_out[o] = vals_in[i];
+      perm_out[o] = perm_in[i];
+    }
+  };
+#ifdef OMEGA_H_USE_OPENMP
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+  for (int t = 0; t < nthreads; ++t) scatter(t);
+  return true;
+}
+
+template <Int N, typename T>
+static LOs radix_sort_by_keys(Read<T> keys) {
+  typedef typename std::make_unsigned<T>::type U;
+  auto n = divide_no_remainder(keys.size(), N);
+  auto nthreads = radix_nthreads(n);
+  T const* keyptr = keys.data();
+  Write<LO> perm(n, 0, 1);
+  Write<LO> perm2(n);
+  std::vector<U> vals(static_cast<std::size_t>(n));
+  std::vector<U> vals2(static_cast<std::size_t>(n));
+  for (Int c = N - 1; c >= 0; --c) {
+    T minval = ArithTraits<T>::max();
+    T maxval = ArithTraits<T>::min();
+#ifdef OMEGA_H_USE_OPENMP
+#pragma omp parallel for num_threads(nthreads) reduction(min:minval) reduction(max:maxval)
+#endif
+    for (LO i = 0; i < n; ++i) {
+      minval = min2(minval, keyptr[i * N + c]);
+      maxval = max2(maxval, keyptr[i * N + c]);
+    }
+    /* unsigned subtraction is exact even when the
+       signed difference would overflow */
+    U spread = U(maxval) - U(minval);
+    if (spread == 0) continue;
+    LO const* p = perm.data();
+    U* v = vals.data();
+#ifdef OMEGA_H_USE_OPENMP
+#pragma omp parallel for num_threads(nthreads)
+#endif
+    for (LO i = 0; i < n; ++i) {
+      v[i] = U(U(keyptr[p[i] * N + c]) - U(minval));
+    }
+    for (Int shift = 0; shift < Int(sizeof(U) * CHAR_BIT) && (spread >> shift);
+         shift += RADIX_BITS) {
+      if (radix_pass(n, nthreads, shift, vals.data(), perm.data(),
+              vals2.data(), perm2.data())) {
+        std::swap(vals, vals2);
+        std::swap(perm, perm2);
+      }
+    }
+  }
+  return perm;
+}
+
+/* under this many keys the comparison sort wins */
+enum { RADIX_SORT_MIN_KEYS = 1024 };
+
+#endif
+
+template <Int N, typename T>
+static LOs sort_by_keys_tmpl(Read<T> keys, SortAlgorithm algorithm) {
+  begin_code("sort_by_keys");
+  LOs perm;
+#ifndef OMEGA_H_USE_CUDA
+  if (algorithm == RADIX_SORT) {
+    perm = radix_sort_by_keys<N>(keys);
+  } else
+#else
+  (void)algorithm;
+#endif
+  {
+    perm = comparison_sort_by_keys<N>(keys);
+  }
   end_code();
   return perm;
 }
 
 template <typename T>
-LOs sort_by_keys(Read<T> keys, Int width) {
+LOs sort_by_keys(Read<T> keys, Int width, SortAlgorithm algorithm) {
   switch (width) {
     case 1:
-      return sort_by_keys_tmpl<1>(keys);
+      return sort_by_keys_tmpl<1>(keys, algorithm);
     case 2:
-      return sort_by_keys_tmpl<2>(keys);
+      return sort_by_keys_tmpl<2>(keys, algorithm);
     case 3:
-      return sort_by_keys_tmpl<3>(keys);
+      return sort_by_keys_tmpl<3>(keys, algorithm);
   }
   OMEGA_H_NORETURN(LOs());
 }
 
-#define INST(T) template LOs sort_by_keys(Read<T> keys, Int width);
+template <typename T>
+LOs sort_by_keys(Read<T> keys, Int width) {
+#ifdef OMEGA_H_USE_CUDA
+  auto algorithm = COMPARISON_SORT;
+#else
+  auto algorithm =
+      (keys.size() / width < RADIX_SORT_MIN_KEYS) ? COMPARISON_SORT : RADIX_SORT;
+#endif
+  return sort_by_keys(keys, width, algorithm);
+}
+
+#define INST(T)                                                                \
+  template LOs sort_by_keys(Read<T> keys, Int width);                          \
+  template LOs sort_by_keys(Read<T> keys, Int width, SortAlgorithm algorithm);
 INST(LO)
 INST(GO)
 #undef INST
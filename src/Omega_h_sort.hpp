@@ -21,8 +21,20 @@ namespace Omega_h {
 template <typename T>
 LOs sort_by_keys(Read<T> keys, Int width = 1);
 
+/* sort_by_keys() picks one of these on its own:
+   on the host, large arrays go through an LSD radix
+   sort and small ones through a comparison sort.
+   Both return exactly the same permutation, this
+   overload is provided to compare the two. */
+enum SortAlgorithm { COMPARISON_SORT, RADIX_SORT };
+
+template <typename T>
+LOs sort_by_keys(Read<T> keys, Int width, SortAlgorithm algorithm);
+
 #define OMEGA_H_INST_DECL(T)                                                   \
-  extern template LOs sort_by_keys(Read<T> keys, Int width);
+  extern template LOs sort_by_keys(Read<T> keys, Int width);                   \
+  extern template LOs sort_by_keys(                                            \
+      Read<T> keys, Int width, SortAlgorithm algorithm);
 OMEGA_H_INST_DECL(LO)
 OMEGA_H_INST_DECL(GO)
 #undef OMEGA_H_INST_DECL
@@ -2,6 +2,7 @@
 
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_map.hpp"
+#include "Omega_h_mark.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_swap2d.hpp"
 #include "Omega_h_swap3d.hpp"
@@ -18,7 +19,15 @@ bool swap_part1(Mesh* mesh, AdaptOpts const& opts) {
   /* only swap interior edges */
   auto edges_are_inter = mark_by_class_dim(mesh, EDGE, mesh->dim());
   edges_are_cands = land_each(edges_are_cands, edges_are_inter);
-  if (get_max(comm, edges_are_cands) <= 0) return false;
+  /* an edge can also become a candidate when a change
+     within the sliver layers makes a new sliver */
+  auto dirty_edges = collect_dirty(
+      mesh, EDGE, SWAP_DIRTY, opts.ndirty_layers + opts.nsliver_layers);
+  clean_dirty(mesh, SWAP_DIRTY);
+  auto dirty_edge_is_cand = unmap(dirty_edges, edges_are_cands, 1);
+  if (get_max(comm, dirty_edge_is_cand) <= 0) return false;
+  edges_are_cands =
+      map_onto(dirty_edge_is_cand, dirty_edges, mesh->nedges(), I8(0), 1);
   mesh->add_tag(EDGE, "candidate", 1, edges_are_cands);
   return true;
 }
@@ -38,12 +38,23 @@ Tag<T>::Tag(std::string const& name_in, Int ncomps_in)
 
 template <typename T>
 Read<T> Tag<T>::array() const {
+  if (loader_) {
+    array_ = loader_();
+    loader_ = nullptr;
+  }
   return array_;
 }
 
 template <typename T>
 void Tag<T>::set_array(Read<T> array_in) {
   array_ = array_in;
+  loader_ = nullptr;
+}
+
+template <typename T>
+void Tag<T>::set_loader(std::function<Read<T>()> loader_in) {
+  array_ = Read<T>();
+  loader_ = loader_in;
 }
 
 template <typename T>
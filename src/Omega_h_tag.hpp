@@ -2,6 +2,7 @@
 #define OMEGA_H_TAG_HPP
 
 #include <array>
+#include <functional>
 #include <set>
 #include <string>
 
@@ -32,10 +33,14 @@ class Tag : public TagBase {
   Tag(std::string const& name_in, Int ncomps_in);
   Read<T> array() const;
   void set_array(Read<T> array_in);
+  /* defers producing the array until array() is first called,
+     used by readers that can locate data without decoding it */
+  void set_loader(std::function<Read<T>()> loader_in);
   virtual Omega_h_Type type() const override;
 
  private:
-  Read<T> array_;
+  mutable Read<T> array_;
+  mutable std::function<Read<T>()> loader_;
 };
 
 template <typename T>
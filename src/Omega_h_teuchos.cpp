@@ -121,6 +121,8 @@ void update_adapt_opts(AdaptOpts* opts, Teuchos::ParameterList const& pl) {
   set_if_given(&opts->should_coarsen, pl, "Coarsen");
   set_if_given(&opts->should_swap, pl, "Swap");
   set_if_given(&opts->should_coarsen_slivers, pl, "Coarsen Slivers");
+  set_if_given(&opts->should_smooth_slivers, pl, "Smooth Slivers");
+  set_if_given(&opts->max_smooth_rounds, pl, "Max Smooth Rounds");
   if (pl.isSublist("Transfer")) {
     update_transfer_opts(&opts->xfer_opts, pl.sublist("Transfer"));
   }
@@ -5,6 +5,7 @@
 #include "Omega_h_fit.hpp"
 #include "Omega_h_map.hpp"
 #include "Omega_h_metric.hpp"
+#include "Omega_h_modify.hpp"
 #include "Omega_h_quality.hpp"
 #include "Omega_h_shape.hpp"
 
@@ -139,7 +140,7 @@ static bool should_transfer_no_products(
 static bool should_transfer_copy(
     Mesh* mesh, TransferOpts const& opts, Int dim, TagBase const* tag) {
   return should_transfer_no_products(mesh, opts, dim, tag) ||
-         tag->name() == "global";
+         tag->name() == "global" || tag->name() == "dirty";
 }
 
 static bool should_transfer_density(
@@ -162,8 +163,8 @@ void transfer_common2(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
   auto const& name = tagbase->name();
   auto ncomps = tagbase->ncomps();
   auto old_data = old_mesh->get_array<T>(ent_dim, name);
-  auto same_data = unmap(same_ents2old_ents, old_data, ncomps);
-  map_into(same_data, same_ents2new_ents, new_data, ncomps);
+  remap_into(
+      old_data, same_ents2old_ents, same_ents2new_ents, new_data, ncomps);
   transfer_common3(new_mesh, ent_dim, tagbase, new_data);
 }
 
@@ -171,8 +172,14 @@ template <typename T>
 void transfer_common(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
     LOs same_ents2old_ents, LOs same_ents2new_ents, LOs prods2new_ents,
     TagBase const* tagbase, Read<T> prod_data) {
-  auto nnew_ents = new_mesh->nents(ent_dim);
   auto ncomps = tagbase->ncomps();
+  if (kept_numbering(
+          old_mesh->nents(ent_dim), prods2new_ents, same_ents2old_ents)) {
+    auto old_data = old_mesh->get_array<T>(ent_dim, tagbase->name());
+    new_mesh->add_tag(ent_dim, tagbase->name(), ncomps, old_data, true);
+    return;
+  }
+  auto nnew_ents = new_mesh->nents(ent_dim);
   auto new_data = Write<T>(nnew_ents * ncomps);
   map_into(prod_data, prods2new_ents, new_data, ncomps);
   transfer_common2(old_mesh, new_mesh, ent_dim, same_ents2old_ents,
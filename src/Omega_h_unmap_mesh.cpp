@@ -63,7 +63,7 @@ void unmap_owners(Mesh* old_mesh, Mesh* new_mesh, Int ent_dim,
 
 void unmap_mesh(Mesh* mesh, LOs new_ents2old_ents[]) {
   auto new_mesh = mesh->copy_meta();
-  new_mesh.set_verts(mesh->nverts());
+  new_mesh.set_verts(new_ents2old_ents[VERT].size());
   LOs old_lows2new_lows;
   for (Int ent_dim = 0; ent_dim <= mesh->dim(); ++ent_dim) {
     if (ent_dim > VERT) {
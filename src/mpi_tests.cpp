@@ -2,14 +2,52 @@
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_bipart.hpp"
 #include "Omega_h_compare.hpp"
+#include "Omega_h_diffuse.hpp"
 #include "Omega_h_inertia.hpp"
+#include "Omega_h_mark.hpp"
+#include "Omega_h_multilevel.hpp"
 #include "Omega_h_owners.hpp"
 #include "Omega_h_vtk.hpp"
 
+#include <fstream>
 #include <sstream>
+#include <vector>
 
 using namespace Omega_h;
 
+static void test_comm(CommPtr comm) {
+  auto rank = comm->rank();
+  auto size = comm->size();
+  OMEGA_H_CHECK(
+      comm->allreduce(I32(rank), OMEGA_H_SUM) == size * (size - 1) / 2);
+  OMEGA_H_CHECK(comm->allreduce(Real(rank), OMEGA_H_MAX) == Real(size - 1));
+  OMEGA_H_CHECK(comm->exscan(GO(2), OMEGA_H_SUM) == GO(2 * rank));
+  std::string s = rank ? "" : "hello";
+  comm->bcast_string(s);
+  OMEGA_H_CHECK(s == "hello");
+  /* reversing the order within each half */
+  auto half = comm->split(rank % 2, -rank);
+  OMEGA_H_CHECK(half->size() == (size - rank % 2 + 1) / 2);
+  OMEGA_H_CHECK(half->rank() == (size - 1 - rank) / 2);
+  OMEGA_H_CHECK(half->allreduce(I32(rank), OMEGA_H_MIN) == rank % 2);
+  auto next = (rank + 1) % size;
+  auto prev = (rank + size - 1) % size;
+  auto ring = comm->graph(Read<I32>({next}));
+  OMEGA_H_CHECK(ring->sources() == Read<I32>({prev}));
+  OMEGA_H_CHECK(ring->allgather(rank) == Read<I32>({prev}));
+  OMEGA_H_CHECK(ring->alltoall(Read<I32>({rank})) == Read<I32>({prev}));
+  auto recvd = ring->alltoallv(
+      Read<I32>(rank + 1, rank), LOs({0, rank + 1}), LOs({0, prev + 1}), 1);
+  OMEGA_H_CHECK(recvd == Read<I32>(prev + 1, prev));
+  /* a blocking exchange while a split-phase one is in flight */
+  auto future = ring->ialltoallv(
+      Read<I32>(rank + 1, rank), LOs({0, rank + 1}), LOs({0, prev + 1}), 1);
+  OMEGA_H_CHECK(ring->alltoallv(Read<I32>(2 * rank, rank), LOs({0, rank}),
+                    LOs({0, prev}), 2) == Read<I32>(2 * prev, prev));
+  OMEGA_H_CHECK(future.get() == recvd);
+  ring->barrier();
+}
+
 static void test_one_rank(CommPtr comm) {
   OMEGA_H_CHECK(comm->size() == 1);
   {  // make sure we can operate on zero-length data
@@ -18,6 +56,8 @@ static void test_one_rank(CommPtr comm) {
     dist.set_dest_ranks(Read<I32>({}));
     dist.set_dest_idxs(LOs({}), 0);
     dist.set_roots2items(LOs({0}));
+    DistPlan plan(dist, 1);
+    OMEGA_H_CHECK(plan.exch(Read<I8>({}), 1).size() == 0);
   }
   {
     Dist dist;
@@ -27,6 +67,18 @@ static void test_one_rank(CommPtr comm) {
     Read<GO> a({0, 1, 2, 3});
     auto b = dist.exch(a, 1);
     OMEGA_H_CHECK(b == Read<GO>({3, 2, 1, 0}));
+    DistBundle bundle;
+    bundle.add(Read<I8>({0, 1, 2, 3}), 1);
+    bundle.add(a, 1);
+    bundle.add(Reals({0., 0.5, 1., 1.5, 2., 2.5, 3., 3.5}), 2);
+    bundle = dist.exch(bundle);
+    OMEGA_H_CHECK(bundle.size() == 3);
+    OMEGA_H_CHECK(bundle.get<I8>(0) == Read<I8>({3, 2, 1, 0}));
+    OMEGA_H_CHECK(bundle.get<GO>(1) == b);
+    OMEGA_H_CHECK(bundle.get<Real>(2) ==
+                  Reals({3., 3.5, 2., 2.5, 1., 1.5, 0., 0.5}));
+    DistPlan plan(dist, Int(sizeof(GO)));
+    OMEGA_H_CHECK(plan.exch(a, 1) == b);
   }
 }
 
@@ -56,6 +108,30 @@ static void test_two_ranks_dist(CommPtr comm) {
   } else {
     OMEGA_H_CHECK(b == Reals({1., 0.}));
   }
+  DistBundle bundle;
+  bundle.add(a, 1);
+  bundle.add(Read<I32>(a.size() * 2, comm->rank()), 2);
+  bundle = dist.exch(bundle);
+  OMEGA_H_CHECK(bundle.get<Real>(0) == b);
+  if (comm->rank() == 0) {
+    OMEGA_H_CHECK(bundle.get<I32>(1) == Read<I32>({1, 1, 1, 1, 0, 0}));
+  } else {
+    OMEGA_H_CHECK(bundle.get<I32>(1) == Read<I32>({0, 0, 0, 0}));
+  }
+  auto future = dist.exch_begin(a, 1);
+  OMEGA_H_CHECK(dist.exch_end(future) == b);
+  DistPlan plan(dist, Int(sizeof(Real)));
+  for (Int i = 0; i < 2; ++i) OMEGA_H_CHECK(plan.exch(a, 1) == b);
+  /* the second exchange starts while the plan is busy */
+  auto first = plan.exch_begin(a, 1);
+  auto second = plan.exch_begin(a, 1);
+  OMEGA_H_CHECK(second.get() == b);
+  OMEGA_H_CHECK(first.get() == b);
+  /* a blocking exchange of another plan while this one is in flight */
+  DistPlan inverse(dist.invert(), Int(sizeof(Real)));
+  auto pending = plan.exch_begin(a, 1);
+  OMEGA_H_CHECK(inverse.exch(b, 1) == a);
+  OMEGA_H_CHECK(pending.get() == b);
   auto c = dist.invert().exch(b, 1);
   OMEGA_H_CHECK(c == a);
 }
@@ -218,6 +294,148 @@ static void test_binary_io(Library* lib, CommPtr comm) {
       OMEGA_H_SAME == compare_meshes(&mesh0, &mesh2, opts, true, true));
 }
 
+static void test_shared_file(Library* lib, CommPtr comm) {
+  auto mesh0 = build_box(comm, 1., 1., 0., 4, 4, 0);
+  mesh0.add_tag(VERT, "field", 1, Reals(mesh0.nverts(), 4.2));
+  auto opts = MeshCompareOpts::init(&mesh0, VarCompareOpts::zero_tolerance());
+  for (auto codec : {binary::default_codec, binary::NO_CODEC}) {
+    binary::write_shared("mpi_test_shared.osh", &mesh0, codec);
+    Mesh mesh1(lib);
+    OMEGA_H_CHECK(
+        binary::read("mpi_test_shared.osh", comm, &mesh1) == comm->size());
+    OMEGA_H_CHECK(
+        OMEGA_H_SAME == compare_meshes(&mesh0, &mesh1, opts, true, true));
+  }
+  /* a file written by one rank, read by all of them */
+  auto one = comm->split(comm->rank(), 0);
+  if (comm->rank() == 0) {
+    auto serial = build_box(one, 1., 1., 0., 4, 4, 0);
+    serial.add_tag(VERT, "field", 1, Reals(serial.nverts(), 4.2));
+    binary::write_shared("mpi_test_shared.osh", &serial);
+  }
+  comm->barrier();
+  Mesh mesh2(lib);
+  OMEGA_H_CHECK(binary::read("mpi_test_shared.osh", comm, &mesh2) == 1);
+  OMEGA_H_CHECK(binary::read_version("mpi_test_shared.osh", comm) ==
+                binary::latest_version);
+  mesh2.balance();
+  OMEGA_H_CHECK(mesh2.nglobal_ents(mesh2.dim()) == 32);
+  OMEGA_H_CHECK(comm->reduce_and(mesh2.nelems() > 0));
+  OMEGA_H_CHECK(
+      OMEGA_H_SAME == compare_meshes(&mesh0, &mesh2, opts, false, false));
+}
+
+static void test_read_fewer_ranks(Library* lib, CommPtr comm) {
+  auto mesh0 = build_box(comm, 1., 1., 0., 4, 4, 0);
+  mesh0.add_tag(VERT, "field", 1, Reals(mesh0.nverts(), 4.2));
+  binary::write("mpi_test_fewer.osh", &mesh0);
+  mesh0.set_parting(OMEGA_H_GHOSTED);
+  binary::write_shared("mpi_test_fewer_shared.osh", &mesh0);
+  if (comm->rank() == 0) {
+    /* parts start aligned, so those read into one buffer map in place */
+    std::ifstream file("mpi_test_fewer_shared.osh", std::ios::binary);
+    file.seekg(2 + 4 + 4);
+    for (I32 part = 0; part < comm->size(); ++part) {
+      I64 offset;
+      file.read(reinterpret_cast<char*>(&offset), sizeof(offset));
+      OMEGA_H_CHECK(offset % 8 == 0);
+    }
+  }
+  auto nhalf = (comm->size() + 1) / 2;
+  auto is_half = (comm->rank() < nhalf);
+  auto half = comm->split(I32(!is_half), 0);
+  if (!is_half) return;
+  auto mesh1 = build_box(half, 1., 1., 0., 4, 4, 0);
+  mesh1.add_tag(VERT, "field", 1, Reals(mesh1.nverts(), 4.2));
+  auto opts = MeshCompareOpts::init(&mesh1, VarCompareOpts::zero_tolerance());
+  for (auto path : {"mpi_test_fewer.osh", "mpi_test_fewer_shared.osh"}) {
+    Mesh mesh2(lib);
+    OMEGA_H_CHECK(binary::read(path, half, &mesh2) == comm->size());
+    OMEGA_H_CHECK(
+        OMEGA_H_SAME == compare_meshes(&mesh1, &mesh2, opts, true, true));
+  }
+}
+
+static void test_unghost(CommPtr comm) {
+  auto mesh0 = build_box(comm, 1., 1., 0., 4, 4, 0);
+  mesh0.add_tag(VERT, "field", 1, Reals(mesh0.nverts(), 4.2));
+  auto mesh1 = mesh0;
+  for (Int nlayers = 1; nlayers <= 2; ++nlayers) {
+    mesh1.set_parting(OMEGA_H_GHOSTED, nlayers, false);
+    mesh1.set_parting(OMEGA_H_ELEM_BASED);
+    OMEGA_H_CHECK(mesh1.nglobal_ents(mesh1.dim()) == 32);
+    for (Int d = 0; d <= mesh1.dim(); ++d) {
+      OMEGA_H_CHECK(mesh1.nents(d) == mesh0.nents(d));
+      auto globals = mesh1.globals(d);
+      OMEGA_H_CHECK(mesh1.sync_array(d, globals, 1) == globals);
+    }
+    auto opts = MeshCompareOpts::init(&mesh0, VarCompareOpts::zero_tolerance());
+    OMEGA_H_CHECK(
+        OMEGA_H_SAME == compare_meshes(&mesh0, &mesh1, opts, true, true));
+  }
+  auto nbytes = comm->allreduce(mesh1.nunmigrated_bytes(), OMEGA_H_SUM);
+  OMEGA_H_CHECK((nbytes > 0) == (comm->size() > 1));
+}
+
+static void test_reorder(CommPtr comm) {
+  auto mesh0 = build_box(comm, 1., 1., 0., 4, 4, 0);
+  auto mesh1 = mesh0;
+  reorder_by_rcm(&mesh1);
+  /* in parallel the global numbers go along with their entities */
+  if (comm->size() == 1) return;
+  auto opts = MeshCompareOpts::init(&mesh0, VarCompareOpts::zero_tolerance());
+  OMEGA_H_CHECK(
+      OMEGA_H_SAME == compare_meshes(&mesh0, &mesh1, opts, true, true));
+  /* so adapting in parallel with reordering gives the same mesh */
+  mesh0.add_tag(VERT, "metric", 1,
+      Reals(mesh0.nverts(), metric_eigenvalue_from_length(0.15)));
+  mesh1 = mesh0;
+  auto adapt_opts = AdaptOpts(&mesh0);
+  adapt_opts.verbosity = SILENT;
+  adapt(&mesh0, adapt_opts);
+  adapt_opts.reordering = REORDER_BY_RCM;
+  adapt_opts.reorder_every = 1;
+  adapt(&mesh1, adapt_opts);
+  opts = MeshCompareOpts::init(&mesh0, VarCompareOpts::zero_tolerance());
+  OMEGA_H_CHECK(
+      OMEGA_H_SAME == compare_meshes(&mesh0, &mesh1, opts, true, true));
+}
+
+static void test_dirty(CommPtr comm) {
+  auto mesh0 = build_box(comm, 1., 1., 0., 4, 4, 0);
+  /* as if only rank 0 had changed elements around its vertices,
+     all copies of a vertex still agree on whether it is dirty */
+  mesh0.add_tag(VERT, "dirty", 1,
+      Read<I8>(mesh0.nverts(), I8(comm->rank() ? 0 : ALL_DIRTY)));
+  for (Int nlayers = 0; nlayers <= 1; ++nlayers) {
+    auto marks = mark_dirty(&mesh0, VERT, REFINE_DIRTY, nlayers);
+    OMEGA_H_CHECK(mesh0.sync_array(VERT, marks, 1) == marks);
+  }
+  mesh0.remove_tag(VERT, "dirty");
+  /* skipping candidates away from changes does not change the result */
+  auto coords = mesh0.coords();
+  Write<Real> metrics(mesh0.nverts());
+  auto f = OMEGA_H_LAMBDA(LO v) {
+    auto x = coords[v * 2 + 0];
+    auto y = coords[v * 2 + 1];
+    metrics[v] = metric_eigenvalue_from_length(0.02 + 0.2 * (x * x + y));
+  };
+  parallel_for(mesh0.nverts(), f);
+  mesh0.add_tag(VERT, "metric", 1, Reals(metrics));
+  auto mesh1 = mesh0;
+  auto opts = AdaptOpts(&mesh0);
+  opts.verbosity = SILENT;
+  opts.should_skip_clean = false;
+  adapt(&mesh0, opts);
+  opts.should_skip_clean = true;
+  opts.ndirty_layers = 0;
+  adapt(&mesh1, opts);
+  auto compare_opts =
+      MeshCompareOpts::init(&mesh0, VarCompareOpts::zero_tolerance());
+  OMEGA_H_CHECK(OMEGA_H_SAME ==
+                compare_meshes(&mesh0, &mesh1, compare_opts, true, true));
+}
+
 static void test_two_ranks(Library* lib, CommPtr comm) {
   test_two_ranks_dist(comm);
   test_two_ranks_owners(comm);
@@ -259,9 +477,150 @@ static void test_rib(CommPtr comm) {
   OMEGA_H_CHECK(masses == Reals(n, 1));
 }
 
+/* a path through all nodes, dealt out to the ranks like cards,
+   should come back as one piece of the path per rank */
+static void test_multilevel_path(CommPtr comm) {
+  auto rank = comm->rank();
+  auto size = comm->size();
+  LO n = 10;
+  auto nnodes = n * size;
+  HostWrite<LO> a2ab(n + 1);
+  std::vector<I32> ranks;
+  std::vector<LO> idxs;
+  a2ab[0] = 0;
+  for (LO a = 0; a < n; ++a) {
+    auto global = a * size + rank;
+    for (auto neighbor : {global - 1, global + 1}) {
+      if (neighbor < 0 || neighbor >= nnodes) continue;
+      ranks.push_back(neighbor % size);
+      idxs.push_back(neighbor / size);
+    }
+    a2ab[a + 1] = LO(idxs.size());
+  }
+  auto nedges = LO(idxs.size());
+  HostWrite<I32> ab2ranks(nedges);
+  HostWrite<LO> ab2idxs(nedges);
+  for (LO ab = 0; ab < nedges; ++ab) {
+    ab2ranks[ab] = ranks[std::size_t(ab)];
+    ab2idxs[ab] = idxs[std::size_t(ab)];
+  }
+  multilevel::DistGraph graph;
+  graph.comm = comm;
+  graph.weights = Reals(n, 1.0);
+  graph.a2ab = a2ab.write();
+  graph.ab2b = Remotes(ab2ranks.write(), ab2idxs.write());
+  graph.ab_weights = Reals(nedges, 1.0);
+  auto objectives = {OMEGA_H_GRAPH_CUT, OMEGA_H_GRAPH_VOLUME};
+  for (auto objective : objectives) {
+    auto parts = multilevel::partition(graph, objective, 1.0);
+    auto edges2nodes = Dist(comm, graph.ab2b, n);
+    auto ab2parts = edges2nodes.invert().exch(parts, 1);
+    auto host_parts = HostRead<I32>(parts);
+    auto host_ab2parts = HostRead<I32>(ab2parts);
+    LO ncut = 0;
+    for (LO a = 0; a < n; ++a) {
+      for (auto ab = a2ab[a]; ab < a2ab[a + 1]; ++ab) {
+        ncut += (host_ab2parts[ab] != host_parts[a]);
+      }
+    }
+    /* each cut edge is seen from both ends */
+    OMEGA_H_CHECK(comm->allreduce(ncut, OMEGA_H_SUM) == 2 * (size - 1));
+    auto nodes2parts = Dist(comm, Remotes(parts, LOs(n, 0)), 1);
+    auto part_size = nodes2parts.exch_reduce(LOs(n, 1), 1, OMEGA_H_SUM);
+    OMEGA_H_CHECK(part_size == LOs({n}));
+  }
+}
+
+/* a path cut into pieces of growing length, one per rank,
+   should even out by moving nodes along the path */
+static void test_diffuse_path(CommPtr comm) {
+  auto rank = comm->rank();
+  auto size = comm->size();
+  LO n = 4 * (rank + 1);
+  LO first = 2 * rank * (rank + 1);
+  LO nnodes = 2 * size * (size + 1);
+  HostWrite<LO> a2ab(n + 1);
+  std::vector<I32> ranks;
+  std::vector<LO> idxs;
+  a2ab[0] = 0;
+  for (LO a = 0; a < n; ++a) {
+    for (auto neighbor : {first + a - 1, first + a + 1}) {
+      if (neighbor < 0 || neighbor >= nnodes) continue;
+      auto neighbor_rank = rank;
+      if (neighbor < first) neighbor_rank = rank - 1;
+      if (neighbor >= first + n) neighbor_rank = rank + 1;
+      auto neighbor_first = 2 * neighbor_rank * (neighbor_rank + 1);
+      ranks.push_back(neighbor_rank);
+      idxs.push_back(neighbor - neighbor_first);
+    }
+    a2ab[a + 1] = LO(idxs.size());
+  }
+  auto nedges = LO(idxs.size());
+  HostWrite<I32> ab2ranks(nedges);
+  HostWrite<LO> ab2idxs(nedges);
+  for (LO ab = 0; ab < nedges; ++ab) {
+    ab2ranks[ab] = ranks[std::size_t(ab)];
+    ab2idxs[ab] = idxs[std::size_t(ab)];
+  }
+  multilevel::DistGraph graph;
+  graph.comm = comm;
+  graph.weights = Reals(n, 1.0);
+  graph.a2ab = a2ab.write();
+  graph.ab2b = Remotes(ab2ranks.write(), ab2idxs.write());
+  graph.ab_weights = Reals(nedges, 1.0);
+  auto dests = diffusion::rebalance(graph, 1.05);
+  auto nodes2dests = Dist(comm, Remotes(dests, LOs(n, 0)), 1);
+  auto new_n = HostRead<LO>(
+      nodes2dests.exch_reduce(LOs(n, 1), 1, OMEGA_H_SUM))[0];
+  auto avg_n = 2 * (size + 1);
+  OMEGA_H_CHECK(avg_n - 1 <= new_n && new_n <= avg_n + 1);
+  auto nmoved = get_sum(comm, each_neq_to(dests, rank));
+  /* rank (r) passes on to rank (r - 1) what ranks
+     from (r) up have over the average */
+  LO nexcess = 0;
+  for (I32 r = 1; r < size; ++r) {
+    nexcess += (2 * size * (size + 1) - 2 * r * (r + 1)) - (size - r) * avg_n;
+  }
+  OMEGA_H_CHECK(nmoved <= nexcess + size);
+  /* already balanced, nothing moves */
+  graph.weights = Reals(n, 1.0 / Real(n));
+  OMEGA_H_CHECK(diffusion::rebalance(graph, 1.05) == Read<I32>(n, rank));
+}
+
+static void test_multilevel_box(CommPtr comm) {
+  auto mesh = build_box(comm, 1., 1., 0., 8, 8, 0);
+  auto modes = {
+      OMEGA_H_GRAPH_CUT, OMEGA_H_GRAPH_VOLUME, OMEGA_H_RIB, OMEGA_H_DIFFUSE};
+  for (auto mode : modes) {
+    mesh.balance(mode);
+    OMEGA_H_CHECK(mesh.nglobal_ents(mesh.dim()) == 128);
+    OMEGA_H_CHECK(mesh.imbalance() <= 1.1);
+    if (comm->size() == 1) {
+      OMEGA_H_CHECK(mesh.edge_cut() == 0);
+      OMEGA_H_CHECK(mesh.comm_volume() == 0);
+    } else {
+      OMEGA_H_CHECK(mesh.edge_cut() > 0);
+      OMEGA_H_CHECK(mesh.comm_volume() > 0);
+    }
+  }
+}
+
+/* all elements on rank 0, the others have no neighbors to diffuse to */
+static void test_diffuse_empty_ranks(CommPtr comm) {
+  auto mesh = Mesh(comm->library());
+  if (comm->rank() == 0) {
+    mesh = build_box(comm->library()->self(), 1., 1., 0., 8, 8, 0);
+  }
+  mesh.set_comm(comm);
+  mesh.balance(OMEGA_H_DIFFUSE);
+  OMEGA_H_CHECK(mesh.nglobal_ents(mesh.dim()) == 128);
+  OMEGA_H_CHECK(mesh.imbalance() <= 1.1);
+}
+
 int main(int argc, char** argv) {
   auto lib = Library(&argc, &argv);
   auto world = lib.world();
+  test_comm(world);
   if (world->rank() == 0) {
     test_one_rank(lib.self());
   }
@@ -278,4 +637,40 @@ int main(int argc, char** argv) {
   }
   world->barrier();
   test_rib(world);
+  test_multilevel_path(world);
+  test_multilevel_box(world);
+  test_diffuse_path(world);
+  test_diffuse_empty_ranks(world);
+  test_shared_file(&lib, world);
+  test_read_fewer_ranks(&lib, world);
+  test_unghost(world);
+  test_reorder(world);
+  test_dirty(world);
+#ifndef OMEGA_H_USE_MPI
+  /* again, on ranks that are threads of this process */
+  run_thread_ranks(&lib, 4, [&](CommPtr comm) {
+    test_comm(comm);
+    auto two = comm->split(comm->rank() / 2, comm->rank() % 2);
+    if (comm->rank() / 2 == 0) {
+      test_two_ranks_dist(two);
+      test_two_ranks_owners(two);
+      test_two_ranks_bipart(two);
+      test_two_ranks_exch_sum(two);
+      test_construct(&lib, two);
+      test_read_vtu(&lib, two);
+      test_binary_io(&lib, two);
+    }
+    comm->barrier();
+    test_rib(comm);
+    test_multilevel_path(comm);
+    test_multilevel_box(comm);
+    test_diffuse_path(comm);
+    test_diffuse_empty_ranks(comm);
+    test_shared_file(&lib, comm);
+    test_read_fewer_ranks(&lib, comm);
+    test_unghost(comm);
+    test_reorder(comm);
+    test_dirty(comm);
+  });
+#endif
 }
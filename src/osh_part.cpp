@@ -1,13 +1,15 @@
 #include <iostream>
+#include <string>
 #include "Omega_h.hpp"
 #include "Omega_h_timer.hpp"
 
 int main(int argc, char** argv) {
   auto lib = Omega_h::Library(&argc, &argv);
   auto world = lib.world();
-  if (argc != 4) {
+  if (argc != 4 && argc != 5) {
     if (!world->rank()) {
-      std::cout << "usage: " << argv[0] << " in.osh <nparts> out.osh\n";
+      std::cout << "usage: " << argv[0]
+                << " in.osh <nparts> out.osh [rib|cut|volume|diffuse]\n";
     }
     return -1;
   }
@@ -15,6 +17,22 @@ int main(int argc, char** argv) {
   auto path_in = argv[1];
   auto nparts_out = atoi(argv[2]);
   auto path_out = argv[3];
+  auto mode = OMEGA_H_RIB;
+  if (argc == 5) {
+    auto mode_name = std::string(argv[4]);
+    if (mode_name == "cut") {
+      mode = OMEGA_H_GRAPH_CUT;
+    } else if (mode_name == "volume") {
+      mode = OMEGA_H_GRAPH_VOLUME;
+    } else if (mode_name == "diffuse") {
+      mode = OMEGA_H_DIFFUSE;
+    } else if (mode_name != "rib") {
+      if (!world->rank()) {
+        std::cout << "error: unknown partitioner " << mode_name << '\n';
+      }
+      return -1;
+    }
+  }
   auto t0 = Omega_h::now();
   if (nparts_out < 1) {
     if (!world->rank()) {
@@ -29,37 +47,29 @@ int main(int argc, char** argv) {
     }
     return -1;
   }
-  auto nparts_in = Omega_h::binary::read_nparts(path_in, world);
-  if (nparts_in > nparts_total) {
-    if (!world->rank()) {
-      std::cout << "error: input part count " << nparts_in
-                << " greater than MPI job size " << nparts_total << '\n';
-    }
-    return -1;
-  }
-  auto is_in = (world->rank() < nparts_in);
-  auto comm_in = world->split(int(is_in), 0);
   auto is_out = (world->rank() < nparts_out);
   auto comm_out = world->split(int(is_out), 0);
   auto mesh = Omega_h::Mesh(&lib);
-  auto version = Omega_h::binary::read_version(path_in, world);
-  if (is_in) {
-    Omega_h::binary::read_in_comm(path_in, comm_in, &mesh, version);
-    if (nparts_out < nparts_in) {
-      Omega_h_fail(
-          "partitioning to a smaller part count not yet implemented\n");
-    }
-  }
-  if (is_in || is_out) mesh.set_comm(comm_out);
   if (is_out) {
-    if (nparts_out != nparts_in) mesh.balance();
+    auto nparts_in = Omega_h::binary::read(path_in, comm_out, &mesh);
+    if (nparts_out != nparts_in) mesh.balance(mode);
     Omega_h::binary::write(path_out, &mesh);
   }
   world->barrier();
   auto t1 = Omega_h::now();
-  auto imb = mesh.imbalance();
+  Omega_h::Real imb = 1.0;
+  Omega_h::GO cut = 0;
+  Omega_h::GO volume = 0;
+  if (is_out) {
+    mesh.set_parting(OMEGA_H_ELEM_BASED);
+    imb = mesh.imbalance();
+    cut = mesh.edge_cut();
+    volume = mesh.comm_volume();
+  }
   if (!world->rank()) {
     std::cout << "repartitioning took " << (t1 - t0) << " seconds\n";
     std::cout << "imbalance is " << imb << "\n";
+    std::cout << "edge cut is " << cut << " sides\n";
+    std::cout << "communication volume is " << volume << " vertices\n";
   }
 }
@@ -1,16 +1,22 @@
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <iostream>
 #include <random>
+#include <sstream>
 
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_build.hpp"
 #include "Omega_h_eigen.hpp"
+#include "Omega_h_file.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_mesh.hpp"
 #include "Omega_h_metric.hpp"
+#include "Omega_h_quality.hpp"
+#include "Omega_h_shape.hpp"
 #include "Omega_h_sort.hpp"
 #include "Omega_h_timer.hpp"
+#include "Omega_h_unmap_mesh.hpp"
 
 using namespace Omega_h;
 
@@ -159,10 +165,30 @@ static void test_sort_n(Int width) {
             << niters << " times takes " << (t1 - t0) << " seconds\n";
 }
 
+static void test_sort_algorithm(
+    Read<LO> keys, Int width, SortAlgorithm algorithm, char const* name) {
+  Now t0 = now();
+  auto perm = sort_by_keys(keys, width, algorithm);
+  Now t1 = now();
+  std::cout << "  " << name << " sort takes " << (t1 - t0) << " seconds\n";
+}
+
+/* edge vertex pairs, as seen by find_unique() when deriving
+   the edges of a mesh with roughly ten million of them */
+static void test_sort_edges() {
+  LO nedges = 10 * 1000 * 1000;
+  LO nverts = nedges / 7;
+  auto keys = random_ints<LO>(nedges * 2, 0, nverts - 1);
+  std::cout << "sorting " << nedges << " edge keys:\n";
+  test_sort_algorithm(keys, 2, COMPARISON_SORT, "comparison");
+  test_sort_algorithm(keys, 2, RADIX_SORT, "radix");
+}
+
 static void test_sort() {
   test_sort_n(1);
   test_sort_n(2);
   test_sort_n(3);
+  test_sort_edges();
 }
 
 //#endif
@@ -225,10 +251,80 @@ static void test_adjs(Library* lib) {
   test_reflect_down(tets2verts, tris2verts, nverts);
 }
 
+static LOs random_permutation(LO n) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::vector<LO> v(static_cast<std::size_t>(n));
+  for (LO i = 0; i < n; ++i) v[std::size_t(i)] = i;
+  std::shuffle(v.begin(), v.end(), gen);
+  HostWrite<LO> h(n);
+  for (LO i = 0; i < n; ++i) h[i] = v[std::size_t(i)];
+  return h.write();
+}
+
+static void time_mesh_kernels(Mesh* mesh, char const* ordering) {
+  Int niters = 10;
+  Now t0 = now();
+  for (Int i = 0; i < niters; ++i) measure_qualities(mesh);
+  Now t1 = now();
+  for (Int i = 0; i < niters; ++i) measure_edges_metric(mesh);
+  Now t2 = now();
+  std::cout << ordering << " order (locality " << measure_locality(mesh)
+            << "): measure_qualities " << (t1 - t0)
+            << " s, measure_edges_metric " << (t2 - t1) << " s\n";
+}
+
+static void test_reorder(Library* lib) {
+  Mesh mesh(lib);
+  auto nx = 42;
+  build_box_internal(&mesh, 1, 1, 1, nx, nx, nx);
+  mesh.add_tag(VERT, "metric", 1,
+      Reals(mesh.nverts(), metric_eigenvalue_from_length(1.0 / nx)));
+  /* the kind of scrambling many adaptive rebuilds leave behind */
+  LOs new_ents2old_ents[4];
+  for (Int dim = 0; dim <= mesh.dim(); ++dim) {
+    new_ents2old_ents[dim] = random_permutation(mesh.nents(dim));
+  }
+  unmap_mesh(&mesh, new_ents2old_ents);
+  time_mesh_kernels(&mesh, "random");
+  reorder_by_rcm(&mesh);
+  time_mesh_kernels(&mesh, "RCM");
+  reorder_by_hilbert(&mesh);
+  time_mesh_kernels(&mesh, "Hilbert");
+}
+
+static void test_codec(Mesh* mesh, binary::Codec codec, char const* name) {
+  if (!binary::codec_available(codec)) return;
+  std::stringstream stream;
+  auto t0 = now();
+  binary::write(stream, mesh, codec);
+  auto t1 = now();
+  auto nbytes = stream.str().size();
+  Mesh mesh2(mesh->library());
+  mesh2.set_comm(mesh->comm());
+  binary::read(stream, &mesh2, binary::latest_version);
+  auto t2 = now();
+  std::cout << name << ": " << nbytes << " bytes, write " << (t1 - t0)
+            << " s, read " << (t2 - t1) << " s\n";
+}
+
+static void test_codecs(Library* lib) {
+  Mesh mesh(lib);
+  auto nx = 42;
+  build_box_internal(&mesh, 1, 1, 1, nx, nx, nx);
+  mesh.add_tag(VERT, "field", 1, random_reals(mesh.nverts(), 0.0, 1.0));
+  test_codec(&mesh, binary::NO_CODEC, "uncompressed");
+  test_codec(&mesh, binary::ZLIB_CODEC, "zlib");
+  test_codec(&mesh, binary::LZ4_CODEC, "LZ4");
+  test_codec(&mesh, binary::ZSTD_CODEC, "Zstandard");
+}
+
 int main(int argc, char** argv) {
   auto lib = Library(&argc, &argv);
   test_metric_math();
   test_repro_sum();
   test_sort();
   test_adjs(&lib);
+  test_reorder(&lib);
+  test_codecs(&lib);
 }
@@ -1,3 +1,4 @@
+#include "Omega_h_adj.hpp"
 #include "Omega_h_align.hpp"
 #include "Omega_h_array_ops.hpp"
 #include "Omega_h_assoc.hpp"
@@ -5,15 +6,19 @@
 #include "Omega_h_build.hpp"
 #include "Omega_h_compare.hpp"
 #include "Omega_h_confined.hpp"
+#include "Omega_h_control.hpp"
 #include "Omega_h_eigen.hpp"
 #include "Omega_h_hilbert.hpp"
 #include "Omega_h_inertia.hpp"
+#include "Omega_h_lazy.hpp"
 #include "Omega_h_lie.hpp"
 #include "Omega_h_linpart.hpp"
 #include "Omega_h_loop.hpp"
 #include "Omega_h_map.hpp"
+#include "Omega_h_motion.hpp"
 #include "Omega_h_quality.hpp"
 #include "Omega_h_recover.hpp"
+#include "Omega_h_refine.hpp"
 #include "Omega_h_refine_qualities.hpp"
 #include "Omega_h_scan.hpp"
 #include "Omega_h_shape.hpp"
@@ -24,11 +29,13 @@
 #include "Omega_h_vtk.hpp"
 #include "Omega_h_xml.hpp"
 #include "Omega_h_most_normal.hpp"
+#include "Omega_h_pool.hpp"
 
 #ifdef OMEGA_H_USE_TEUCHOSPARSER
 #include "Omega_h_expr.hpp"
 #endif
 
+#include <cmath>
 #include <sstream>
 
 //DEBUG
@@ -264,6 +271,23 @@ static void test_sort() {
     LOs perm = sort_by_keys(a, 3);
     OMEGA_H_CHECK(perm == LOs({1, 0, 2}));
   }
+  {
+    /* enough keys, with negatives and duplicates,
+       to exercise several radix passes */
+    LO n = 5000;
+    HostWrite<GO> h(n * 2);
+    for (LO i = 0; i < n; ++i) {
+      h[i * 2 + 0] = GO((i * 7919) % 61) - 30;
+      h[i * 2 + 1] = (GO((i * 104729) % 997) - 500) * (GO(1) << 40);
+    }
+    Read<GO> a(h.write());
+    for (Int width = 1; width <= 2; ++width) {
+      auto cperm = sort_by_keys(a, width, COMPARISON_SORT);
+      auto rperm = sort_by_keys(a, width, RADIX_SORT);
+      OMEGA_H_CHECK(cperm == rperm);
+      OMEGA_H_CHECK(sort_by_keys(a, width) == rperm);
+    }
+  }
 }
 
 static void test_scan() {
@@ -275,6 +299,53 @@ static void test_scan() {
     LOs scanned = offset_scan(Read<I8>(3, 1));
     OMEGA_H_CHECK(scanned == Read<LO>(4, 0, 1));
   }
+  {
+    LO n = 1000 * 1000;
+    LOs scanned = offset_scan(LOs(n, 1));
+    OMEGA_H_CHECK(scanned == Read<LO>(n + 1, 0, 1));
+    OMEGA_H_CHECK(get_sum(LOs(n, 1)) == n);
+    OMEGA_H_CHECK(get_max(LOs(n, 0, 1)) == n - 1);
+    OMEGA_H_CHECK(get_min(LOs(n, 0, -1)) == -(n - 1));
+  }
+}
+
+static void test_lazy() {
+  Reals a({-1.0, 2.0, -3.0, 4.0});
+  Reals b({1.0, 1.0, 1.0, 5.0});
+  OMEGA_H_CHECK(lazy::get_sum(lazy::each_gt(a, 0.0)) == 2);
+  OMEGA_H_CHECK(lazy::evaluate(lazy::fabs_each(a)) == Reals({1, 2, 3, 4}));
+  OMEGA_H_CHECK(lazy::evaluate(lazy::multiply_each_by(lazy::add_each(a, b),
+                    2.0)) == Reals({0, 6, -4, 18}));
+  OMEGA_H_CHECK(lazy::evaluate(lazy::land_each(lazy::each_geq_to(a, -1.0),
+                    lazy::lt_each(a, b))) == Bytes({1, 0, 0, 1}));
+  OMEGA_H_CHECK(lazy::get_max(lazy::subtract_each(b, a)) == 4.0);
+  auto mm = lazy::get_minmax(lazy::max_each(a, b));
+  OMEGA_H_CHECK(mm.min == 1.0 && mm.max == 5.0);
+  auto imm = lazy::get_minmax(LOs({3, -2, 7}));
+  OMEGA_H_CHECK(imm.min == -2 && imm.max == 7);
+}
+
+static void test_pool() {
+  for (std::size_t n = 1; n < 100 * 1000; n = n * 3 + 1) {
+    auto c = Pool::size_class(n);
+    OMEGA_H_CHECK(Pool::class_bytes(c) >= n);
+    OMEGA_H_CHECK(Pool::class_bytes(c) * 4 <= n * 5 + 256);
+    OMEGA_H_CHECK(c == 0 || Pool::class_bytes(c - 1) < n);
+  }
+  Pool pool;
+  auto a = pool.allocate(1000);
+  pool.deallocate(a, 1000);
+  auto b = pool.allocate(990);
+  OMEGA_H_CHECK(a == b);
+  auto stats = pool.stats();
+  OMEGA_H_CHECK(stats.nallocs == 2);
+  OMEGA_H_CHECK(stats.nreused == 1);
+  OMEGA_H_CHECK(stats.cached_bytes == 0);
+  pool.deallocate(b, 990);
+  OMEGA_H_CHECK(pool.stats().cached_bytes ==
+                Pool::class_bytes(Pool::size_class(1000)));
+  pool.release();
+  OMEGA_H_CHECK(pool.stats().cached_bytes == 0);
 }
 
 static void test_fan_and_funnel() {
@@ -295,6 +366,9 @@ static void test_permute() {
   OMEGA_H_CHECK(permuted == Reals({0.4, 0.3, 0.2, 0.1}));
   Reals back = permute(permuted, perm, 1);
   OMEGA_H_CHECK(back == data);
+  Write<Real> remapped(4, 0.0);
+  remap_into(data, LOs({0, 3}), LOs({2, 1}), remapped, 1);
+  OMEGA_H_CHECK(Reals(remapped) == Reals({0.0, 0.4, 0.1, 0.0}));
 }
 
 static void test_invert_map() {
@@ -433,6 +507,150 @@ static void test_find_unique() {
                 LOs({0, 1, 0, 2, 3, 0, 1, 2, 2, 3}));
 }
 
+static void test_hash_dedup(Library* lib) {
+  auto old_setting = should_hash_dedup;
+  Mesh sorted(lib);
+  build_box_internal(&sorted, 1, 1, 1, 3, 3, 3);
+  should_hash_dedup = true;
+  test_reflect_down();
+  /* unique entities come out in order of first use */
+  OMEGA_H_CHECK(find_unique(LOs({0, 1, 2, 2, 3, 0}), 2, 1) ==
+                LOs({0, 1, 1, 2, 2, 0, 2, 3, 3, 0}));
+  Mesh hashed(lib);
+  build_box_internal(&hashed, 1, 1, 1, 3, 3, 3);
+  should_hash_dedup = old_setting;
+  for (Int dim = 0; dim <= 3; ++dim) {
+    OMEGA_H_CHECK(hashed.nents(dim) == sorted.nents(dim));
+  }
+  /* both paths describe the same faces */
+  auto ntris = sorted.ntris();
+  auto sorted_fv2v = sorted.ask_verts_of(TRI);
+  auto hashed_fv2v = hashed.ask_verts_of(TRI);
+  auto sorted_canon = align_ev2v(
+      3, sorted_fv2v, get_codes_to_canonical(3, sorted_fv2v));
+  auto hashed_canon = align_ev2v(
+      3, hashed_fv2v, get_codes_to_canonical(3, hashed_fv2v));
+  LOs f2f;
+  Read<I8> codes;
+  find_matches(TRI, sorted_canon, hashed_canon,
+      invert_adj(Adj(hashed_canon), 3, hashed.nverts()), &f2f, &codes);
+  OMEGA_H_CHECK(f2f.size() == ntris);
+  OMEGA_H_CHECK(get_sum(invert_marks(mark_image(f2f, ntris))) == 0);
+}
+
+static void test_modify_up(Library* lib) {
+  Mesh mesh(lib);
+  build_box_internal(&mesh, 1, 1, 1, 2, 2, 2);
+  mesh.add_tag(VERT, "metric", 1,
+      Reals(mesh.nverts(), metric_eigenvalue_from_length(0.3)));
+  for (Int dim = 1; dim <= 3; ++dim) mesh.ask_up(dim - 1, dim);
+  auto opts = AdaptOpts(&mesh);
+  opts.verbosity = SILENT;
+  OMEGA_H_CHECK(refine_by_size(&mesh, opts));
+  /* the patched upward adjacencies match derived ones */
+  for (Int dim = 1; dim <= 3; ++dim) {
+    OMEGA_H_CHECK(mesh.has_adj(dim - 1, dim));
+    auto patched = mesh.ask_up(dim - 1, dim);
+    auto derived = invert_adj(mesh.ask_down(dim, dim - 1),
+        simplex_degrees[dim][dim - 1], mesh.nents(dim - 1));
+    OMEGA_H_CHECK(patched.a2ab == derived.a2ab);
+    OMEGA_H_CHECK(patched.ab2b == derived.ab2b);
+    OMEGA_H_CHECK(patched.codes == derived.codes);
+  }
+}
+
+static void test_dirty(Library* lib) {
+  Mesh mesh(lib);
+  build_box_internal(&mesh, 1, 1, 0, 4, 4, 0);
+  /* only the edges along x = 0 are too long */
+  auto coords = HostRead<Real>(mesh.coords());
+  HostWrite<Real> metrics(mesh.nverts());
+  for (LO v = 0; v < mesh.nverts(); ++v) {
+    auto h = (coords[v * 2] < 0.1) ? 0.15 : 1.0;
+    metrics[v] = metric_eigenvalue_from_length(h);
+  }
+  mesh.add_tag(VERT, "metric", 1, Reals(metrics.write()));
+  auto opts = AdaptOpts(&mesh);
+  opts.verbosity = SILENT;
+  /* nothing changed since refinement last looked */
+  mesh.add_tag(VERT, "dirty", 1, Read<I8>(mesh.nverts(), I8(0)));
+  OMEGA_H_CHECK(!refine_by_size(&mesh, opts));
+  mesh.set_tag(VERT, "dirty", Read<I8>(mesh.nverts(), I8(ALL_DIRTY)));
+  OMEGA_H_CHECK(refine_by_size(&mesh, opts));
+  /* only the vertices of new elements are dirty for refinement */
+  auto ndirty = get_sum(mark_dirty(&mesh, VERT, REFINE_DIRTY, 0));
+  OMEGA_H_CHECK(0 < ndirty && ndirty < mesh.nverts());
+  OMEGA_H_CHECK(get_sum(mark_dirty(&mesh, VERT, REFINE_DIRTY, 1)) > ndirty);
+  /* the layers grown from the dirty list match those of whole-mesh marks */
+  auto verts_are_dirty = mark_dirty(&mesh, VERT, REFINE_DIRTY, 0);
+  auto layer =
+      mark_down(&mesh, 2, VERT, mark_up(&mesh, VERT, 2, verts_are_dirty));
+  OMEGA_H_CHECK(mark_dirty(&mesh, VERT, REFINE_DIRTY, 1) == layer);
+  OMEGA_H_CHECK(mark_dirty(&mesh, EDGE, REFINE_DIRTY, 1) ==
+                mark_up(&mesh, VERT, EDGE, layer));
+  OMEGA_H_CHECK(collect_dirty(&mesh, EDGE, REFINE_DIRTY, 1) ==
+                collect_marked(mark_up(&mesh, VERT, EDGE, layer)));
+  OMEGA_H_CHECK(get_min(mark_dirty(&mesh, VERT, COARSEN_DIRTY, 0)) == 1);
+  mesh.set_tag(VERT, "coordinates", mesh.coords());
+  OMEGA_H_CHECK(get_min(mark_dirty(&mesh, VERT, REFINE_DIRTY, 0)) == 1);
+}
+
+static void test_smooth(Library* lib) {
+  auto mesh = build_box(lib->world(), 1., 1., 0., 2, 2, 0);
+  /* push the center vertex towards a corner */
+  auto coords = HostWrite<Real>(deep_copy(mesh.coords()));
+  for (LO v = 0; v < mesh.nverts(); ++v) {
+    if (coords[v * 2] == 0.5 && coords[v * 2 + 1] == 0.5) {
+      coords[v * 2] = 0.85;
+      coords[v * 2 + 1] = 0.8;
+    }
+  }
+  mesh.set_coords(Reals(coords.write()));
+  mesh.add_tag(VERT, "metric", 1,
+      Reals(mesh.nverts(), metric_eigenvalue_from_length(0.5)));
+  auto mesh2 = mesh;
+  mesh.add_tag(VERT, "dirty", 1, Read<I8>(mesh.nverts(), I8(0)));
+  auto nelems = mesh.nelems();
+  auto old_min_qual = mesh.min_quality();
+  auto opts = AdaptOpts(&mesh);
+  opts.verbosity = SILENT;
+  opts.min_quality_desired = 0.9;
+  OMEGA_H_CHECK(smooth_slivers(&mesh, opts));
+  OMEGA_H_CHECK(mesh.nelems() == nelems);
+  OMEGA_H_CHECK(mesh.min_quality() > old_min_qual);
+  /* the caches were updated rather than dropped */
+  OMEGA_H_CHECK(are_close(mesh.ask_qualities(), measure_qualities(&mesh)));
+  OMEGA_H_CHECK(are_close(mesh.ask_lengths(), measure_edges_metric(&mesh)));
+  /* all but the two corners that share no element with the center */
+  OMEGA_H_CHECK(get_sum(mark_dirty(&mesh, VERT, SWAP_DIRTY, 0)) == 7);
+  /* with nothing else to try, adapt() goes on smoothing one round
+     at a time until no vertex can move */
+  opts.max_smooth_rounds = 1;
+  opts.should_smooth_slivers = true;
+  opts.should_refine = false;
+  opts.should_coarsen = false;
+  opts.should_swap = false;
+  opts.should_coarsen_slivers = false;
+  adapt(&mesh2, opts);
+  OMEGA_H_CHECK(mesh2.nelems() == nelems);
+  OMEGA_H_CHECK(mesh2.min_quality() >= mesh.min_quality());
+}
+
+static void test_reorder(Library* lib) {
+  Mesh mesh(lib);
+  build_box_internal(&mesh, 1, 1, 1, 4, 4, 4);
+  auto volume = get_sum(mesh.ask_sizes());
+  LO nents[4];
+  for (Int dim = 0; dim <= 3; ++dim) nents[dim] = mesh.nents(dim);
+  reorder_by_rcm(&mesh);
+  for (Int dim = 0; dim <= 3; ++dim) {
+    OMEGA_H_CHECK(mesh.nents(dim) == nents[dim]);
+    OMEGA_H_CHECK(mesh.globals(dim) == GOs(nents[dim], 0, 1));
+  }
+  OMEGA_H_CHECK(are_close(get_sum(mesh.ask_sizes()), volume));
+  OMEGA_H_CHECK(measure_locality(&mesh) == 1.0);
+}
+
 static void test_hilbert() {
   /* this is the original test from Skilling's paper */
   hilbert::coord_t X[3] = {5, 10, 20};  // any position in 32x32x32 cube
@@ -750,9 +968,9 @@ static void build_empty_mesh(Mesh* mesh, Int dim) {
   build_from_elems_and_coords(mesh, dim, LOs({}), Reals({}));
 }
 
-static void test_file(Library* lib, Mesh* mesh0) {
+static void test_file(Library* lib, Mesh* mesh0, binary::Codec codec) {
   std::stringstream stream;
-  binary::write(stream, mesh0);
+  binary::write(stream, mesh0, codec);
   Mesh mesh1(lib);
   mesh1.set_comm(lib->self());
   binary::read(stream, &mesh1, binary::latest_version);
@@ -762,6 +980,53 @@ static void test_file(Library* lib, Mesh* mesh0) {
   OMEGA_H_CHECK(*mesh0 == mesh1);
 }
 
+static void test_file(Library* lib, Mesh* mesh0) {
+  test_file(lib, mesh0, binary::default_codec);
+  test_file(lib, mesh0, binary::NO_CODEC);
+}
+
+template <typename T>
+static void test_codec(binary::Codec codec, Read<T> a) {
+  std::stringstream stream;
+  binary::write_array(stream, a, codec);
+  Read<T> b;
+  binary::read_array(stream, b, codec != binary::NO_CODEC);
+  OMEGA_H_CHECK(a == b);
+}
+
+static void test_codecs() {
+  /* large enough to span several compression blocks */
+  LO n = 300 * 1000;
+  Write<Real> reals(n);
+  auto f = OMEGA_H_LAMBDA(LO i) { reals[i] = std::sin(Real(i)); };
+  parallel_for(n, f);
+  for (auto codec : {binary::NO_CODEC, binary::ZLIB_CODEC, binary::LZ4_CODEC,
+           binary::ZSTD_CODEC}) {
+    if (!binary::codec_available(codec)) continue;
+    test_codec(codec, Reals(reals));
+    test_codec(codec, Read<I32>(n, 0, 7));
+    test_codec(codec, Read<I8>(LO(0), I8(1)));
+  }
+}
+
+static void test_mapped_file(Library* lib) {
+  auto mesh0 = build_box(lib->world(), 1., 1., 1., 2, 2, 2);
+  mesh0.add_tag(VERT, "field", 1, Reals(mesh0.nverts(), 4.2));
+  binary::write("mapped_test.osh", &mesh0, binary::NO_CODEC);
+  Mesh mesh1(lib);
+  binary::read("mapped_test.osh", lib->world(), &mesh1);
+  auto opts = MeshCompareOpts::init(&mesh0, VarCompareOpts::zero_tolerance());
+  OMEGA_H_CHECK(compare_meshes(&mesh0, &mesh1, opts, true) == OMEGA_H_SAME);
+  /* overwriting the file must not disturb a mesh still mapping it */
+  Mesh mesh2(lib);
+  binary::read("mapped_test.osh", lib->world(), &mesh2);
+  auto coords = mesh0.coords();
+  binary::write("mapped_test.osh", &mesh1, binary::default_codec);
+  OMEGA_H_CHECK(mesh2.coords() == coords);
+  auto field = mesh2.get_array<Real>(VERT, "field");
+  OMEGA_H_CHECK(field == Reals(mesh0.nverts(), 4.2));
+}
+
 static void test_file(Library* lib) {
   {
     auto mesh0 = build_box(lib->world(), 1., 1., 1., 1, 1, 1);
@@ -1166,6 +1431,8 @@ int main(int argc, char** argv) {
   test_sort();
   test_sort_small_range();
   test_scan();
+  test_pool();
+  test_lazy();
   test_intersect_metrics();
   test_fan_and_funnel();
   test_permute();
@@ -1175,6 +1442,7 @@ int main(int argc, char** argv) {
   test_form_uses();
   test_reflect_down();
   test_find_unique();
+  test_hash_dedup(&lib);
   test_hilbert();
   test_bbox();
   test_build_from_elems2verts(&lib);
@@ -1189,11 +1457,17 @@ int main(int argc, char** argv) {
   test_average_field(&lib);
   test_positivize();
   test_refine_qualities(&lib);
+  test_modify_up(&lib);
+  test_dirty(&lib);
+  test_smooth(&lib);
+  test_reorder(&lib);
   test_mark_up_down(&lib);
   test_compare_meshes(&lib);
   test_swap2d_topology(&lib);
   test_swap3d_loop(&lib);
   test_file(&lib);
+  test_codecs();
+  test_mapped_file(&lib);
   test_xml();
   test_read_vtu(&lib);
   test_interpolate_metrics();